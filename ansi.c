@@ -0,0 +1,266 @@
+/**
+ * @file ansi.c
+ * @brief Komut çıktısı için akan (streaming) ANSI/VT SGR çözücü
+ *
+ * ls --color, grep --color ve derleyiciler renkleri "\033[...m" dizileriyle
+ * verir. Çözücü çıktıyı düz metin parçalarına ayırır ve her parçayı o anki
+ * renk/biçimle geri verir; View bunları önbellekli metin etiketlerine çevirir.
+ *
+ * - Düz metin ESC baytı vektör komutlarıyla aranarak toptan geçer (bkz.
+ *   ansi_find_esc); yalnızca dizilerin kendisi bayt bayt işlenir.
+ * - Durum çözücüde saklandığından okumalar arasında bölünen diziler de
+ *   doğru çözülür.
+ * - SGR dışındaki CSI (imleç hareketi, silme), OSC (pencere başlığı) ve iki
+ *   baytlık ESC dizileri gösterilmeden atılır.
+ * - 24 bit renkler en yakın 256 renk paletine indirgenir; böylece stil
+ *   (etiket) sayısı çıktıdan bağımsız olarak sınırlı kalır.
+ */
+
+#include <string.h>
+#if defined(__SSE2__) && !defined(__GLIBC__)
+#include <emmintrin.h>
+#endif
+#include "ansi.h"
+
+enum {
+    ANSI_GROUND,    // Düz metin
+    ANSI_ESC,       // ESC alındı
+    ANSI_CSI,       // "ESC [" parametreleri okunuyor
+    ANSI_OSC,       // "ESC ]" ... BEL veya "ESC \" ile biter
+    ANSI_OSC_ESC,   // OSC içinde ESC alındı
+    ANSI_SKIP_ONE   // "ESC (" gibi, bir bayt daha atlanacak
+};
+
+// Koyu arka planda okunabilir 16 temel renk (xterm sırası: normal, parlak)
+static const unsigned char base_palette[16][3] = {
+    {  0,   0,   0}, {205,  49,  49}, { 13, 188, 121}, {229, 229,  16},
+    { 36, 114, 200}, {188,  63, 188}, { 17, 168, 205}, {229, 229, 229},
+    {102, 102, 102}, {241,  76,  76}, { 35, 209, 139}, {245, 245,  67},
+    { 59, 142, 234}, {214, 112, 214}, { 41, 184, 219}, {255, 255, 255},
+};
+
+/**
+ * @brief 256 renk paletindeki rengin RGB değerini verir
+ */
+static void palette_rgb(int index, unsigned char rgb[3]) {
+    static const unsigned char levels[6] = { 0, 95, 135, 175, 215, 255 };
+    if (index < 16) {
+        memcpy(rgb, base_palette[index], 3);
+    } else if (index < 232) {
+        index -= 16;
+        rgb[0] = levels[index / 36];
+        rgb[1] = levels[(index / 6) % 6];
+        rgb[2] = levels[index % 6];
+    } else {
+        rgb[0] = rgb[1] = rgb[2] = (unsigned char)(8 + 10 * (index - 232));
+    }
+}
+
+/**
+ * @brief 24 bit rengi 6x6x6 küpteki veya gri tonlardaki en yakın renge indirger
+ */
+static int nearest_palette(int r, int g, int b) {
+    int cube[3], c[3] = { r, g, b };
+    for (int i = 0; i < 3; i++) cube[i] = c[i] < 48 ? 0 : c[i] < 115 ? 1 : (c[i] - 35) / 40;
+    int best = 16 + 36 * cube[0] + 6 * cube[1] + cube[2];
+    int gray = (r + g + b) / 3;
+    int gray_index = gray > 238 ? 23 : gray < 8 ? 0 : (gray - 8) / 10;
+
+    unsigned char a[3], p[3];
+    palette_rgb(best, a);
+    palette_rgb(232 + gray_index, p);
+    long da = 0, dp = 0;
+    for (int i = 0; i < 3; i++) {
+        da += (long)(a[i] - c[i]) * (a[i] - c[i]);
+        dp += (long)(p[i] - c[i]) * (p[i] - c[i]);
+    }
+    return dp < da ? 232 + gray_index : best;
+}
+
+/**
+ * @brief fg değiştiğinde "#rrggbb" biçimini günceller
+ */
+static void set_fg(AnsiDecoder *d, int index) {
+    d->fg = index;
+    if (index < 0) {
+        d->color[0] = '\0';
+        return;
+    }
+    static const char hex[] = "0123456789abcdef";
+    unsigned char rgb[3];
+    palette_rgb(index, rgb);
+    d->color[0] = '#';
+    for (int i = 0; i < 3; i++) {
+        d->color[1 + 2 * i] = hex[rgb[i] >> 4];
+        d->color[2 + 2 * i] = hex[rgb[i] & 15];
+    }
+    d->color[7] = '\0';
+}
+
+/**
+ * @brief Çözücüyü başlangıç durumuna getirir (varsayılan renk, biçimsiz)
+ */
+void ansi_decoder_init(AnsiDecoder *decoder) {
+    memset(decoder, 0, sizeof(*decoder));
+    decoder->fg = -1;
+}
+
+/**
+ * @brief Metindeki ilk ESC (0x1b) baytını bulur
+ *
+ * glibc'nin memchr'ı çalışma anında işlemciye göre seçilen SSE2/AVX2/EVEX
+ * sürümüdür ve elle yazılmış SSE2 döngüsünden hızlı ölçüldü; o yüzden glibc
+ * ile memchr kullanılır. Diğer libc'lerde (ör. musl'ün memchr'ı bayt/kelime
+ * tabanlı) SSE2 ile 64 baytlık bloklar taranır. ANSI_SCALAR_SCAN ile
+ * derlenince bayt bayt arar (bench/ansibench'teki skaler karşılaştırma).
+ *
+ * @param text Metin
+ * @param len Uzunluk
+ * @return const char* ESC'nin konumu veya yoksa NULL
+ */
+const char* ansi_find_esc(const char *text, size_t len) {
+#if defined(ANSI_SCALAR_SCAN)
+    for (size_t i = 0; i < len; i++) {
+        if (text[i] == 0x1b) return text + i;
+    }
+    return NULL;
+#elif defined(__SSE2__) && !defined(__GLIBC__)
+    const __m128i esc = _mm_set1_epi8(0x1b);
+    size_t i = 0;
+    // 64 baytlık bloklar: dört karşılaştırma tek dalla denetlenir
+    for (; i + 64 <= len; i += 64) {
+        __m128i a = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(text + i)), esc);
+        __m128i b = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(text + i + 16)), esc);
+        __m128i c = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(text + i + 32)), esc);
+        __m128i d = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(text + i + 48)), esc);
+        if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)))) break;
+    }
+    for (; i + 16 <= len; i += 16) {
+        __m128i chunk = _mm_loadu_si128((const __m128i *)(text + i));
+        int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, esc));
+        if (mask) return text + i + __builtin_ctz(mask);
+    }
+    for (; i < len; i++) {
+        if (text[i] == 0x1b) return text + i;
+    }
+    return NULL;
+#else
+    return memchr(text, 0x1b, len);
+#endif
+}
+
+/**
+ * @brief Tamamlanan SGR ("ESC [ ... m") parametrelerini uygular
+ *
+ * Desteklenenler: 0 sıfırla, 1/22 kalın, 4/24 altı çizili, 30-37/90-97 ve
+ * 39 ön plan, 38;5;n ve 38;2;r;g;b. Arka plan ve diğerleri yok sayılır.
+ */
+static void apply_sgr(AnsiDecoder *d) {
+    int values[32], n = 0;
+    const char *p = d->params;
+    const char *end = d->params + d->nparams;
+    // Boş parametre 0 sayılır ("ESC[m" = "ESC[0m"); çok uzun sayılar taşmasın diye
+    // 65536'da durur (geçerli değerlerin hepsi 255'ten küçüktür)
+    while (n < 32) {
+        int v = 0;
+        for (; p < end && *p >= '0' && *p <= '9'; p++) {
+            if (v < 65536) v = v * 10 + (*p - '0');
+        }
+        values[n++] = v;
+        if (p >= end) break;
+        p++; // ';' veya ':'
+    }
+
+    for (int i = 0; i < n; i++) {
+        int v = values[i];
+        if (v == 0) {
+            set_fg(d, -1);
+            d->attrs = 0;
+        } else if (v == 1) {
+            d->attrs |= ANSI_ATTR_BOLD;
+        } else if (v == 22) {
+            d->attrs &= ~ANSI_ATTR_BOLD;
+        } else if (v == 4) {
+            d->attrs |= ANSI_ATTR_UNDERLINE;
+        } else if (v == 24) {
+            d->attrs &= ~ANSI_ATTR_UNDERLINE;
+        } else if (v >= 30 && v <= 37) {
+            set_fg(d, v - 30);
+        } else if (v >= 90 && v <= 97) {
+            set_fg(d, v - 90 + 8);
+        } else if (v == 39) {
+            set_fg(d, -1);
+        } else if ((v == 38 || v == 48) && i + 1 < n) {
+            // Genişletilmiş renk: arka plan (48) için de argümanlar atlanır
+            if (values[i + 1] == 5 && i + 2 < n) {
+                if (v == 38) set_fg(d, values[i + 2] & 0xff);
+                i += 2;
+            } else if (values[i + 1] == 2 && i + 4 < n) {
+                if (v == 38) set_fg(d, nearest_palette(values[i + 2] & 0xff, values[i + 3] & 0xff, values[i + 4] & 0xff));
+                i += 4;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Çıktı parçasını çözer, düz metni renk/biçimiyle emit'e verir
+ *
+ * @param decoder Sekmenin çözücüsü (diziler parçalar arasında sürebilir)
+ * @param text Çıktı parçası
+ * @param len Uzunluk
+ * @param emit Düz metin parçaları için çağrılır
+ * @param ctx emit'e iletilir
+ */
+void ansi_decode(AnsiDecoder *decoder, const char *text, size_t len, AnsiEmitFunc emit, void *ctx) {
+    AnsiDecoder *d = decoder;
+    const char *p = text, *end = text + len;
+    while (p < end) {
+        if (d->state == ANSI_GROUND) {
+            const char *esc = ansi_find_esc(p, end - p);
+            const char *stop = esc ? esc : end;
+            if (stop > p) emit(ctx, p, stop - p, d->fg >= 0 ? d->color : NULL, d->attrs);
+            if (!esc) break;
+            d->state = ANSI_ESC;
+            p = esc + 1;
+            continue;
+        }
+
+        unsigned char c = (unsigned char)*p++;
+        switch (d->state) {
+        case ANSI_ESC:
+            if (c == '[') {
+                d->state = ANSI_CSI;
+                d->nparams = 0;
+            } else if (c == ']') {
+                d->state = ANSI_OSC;
+            } else if (c == '(' || c == ')' || c == '#' || c == '%') {
+                d->state = ANSI_SKIP_ONE; // Karakter kümesi seçimi
+            } else {
+                d->state = ANSI_GROUND;   // "ESC 7", "ESC =" vb.
+            }
+            break;
+        case ANSI_CSI:
+            if (c >= 0x40 && c <= 0x7e) {
+                // Son bayt: yalnızca 'm' (SGR) uygulanır, '?' ile başlayan özel kipler değil
+                if (c == 'm' && d->nparams >= 0 && (d->nparams == 0 || d->params[0] != '?')) apply_sgr(d);
+                d->state = ANSI_GROUND;
+            } else if (d->nparams >= 0 && d->nparams < (int)sizeof(d->params)) {
+                d->params[d->nparams++] = (char)c;
+            } else {
+                d->nparams = -1; // Çok uzun: dizi sonuna kadar okunup atılır
+            }
+            break;
+        case ANSI_OSC:
+            if (c == 0x07) d->state = ANSI_GROUND;
+            else if (c == 0x1b) d->state = ANSI_OSC_ESC;
+            break;
+        case ANSI_OSC_ESC:
+            d->state = c == '\\' ? ANSI_GROUND : ANSI_OSC;
+            break;
+        case ANSI_SKIP_ONE:
+            d->state = ANSI_GROUND;
+            break;
+        }
+    }
+}
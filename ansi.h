@@ -0,0 +1,39 @@
+#ifndef ANSI_H
+#define ANSI_H
+
+#include <stddef.h>
+
+#define ANSI_ATTR_BOLD      1 // SGR 1
+#define ANSI_ATTR_UNDERLINE 2 // SGR 4
+
+/**
+ * @brief Bir sekmenin çıktı akışındaki ANSI/VT çözücü durumu
+ *
+ * Okumalar arasında bölünmüş kaçış dizileri burada tamamlanır; renk ve
+ * biçim bir sonraki SGR dizisine kadar geçerlidir.
+ */
+typedef struct {
+    int state;                // ANSI_GROUND, ANSI_ESC, ANSI_CSI ...
+    char params[64];          // Tamamlanmamış CSI parametreleri
+    int nparams;              // params'taki bayt sayısı (taşarsa dizi yok sayılır)
+    int fg;                   // Ön plan: -1 varsayılan, 0-255 palet indeksi
+    int attrs;                // ANSI_ATTR_*
+    char color[8];            // fg'nin "#rrggbb" biçimi (fg -1 ise boş)
+} AnsiDecoder;
+
+/**
+ * @brief Çözülen her düz metin parçası için çağrılır
+ *
+ * @param ctx ansi_decode'a verilen bağlam
+ * @param text Metin (NUL ile bitmez)
+ * @param len Uzunluk
+ * @param color "#rrggbb" veya varsayılan renk için NULL
+ * @param attrs ANSI_ATTR_* bayrakları
+ */
+typedef void (*AnsiEmitFunc)(void *ctx, const char *text, size_t len, const char *color, int attrs);
+
+void ansi_decoder_init(AnsiDecoder *decoder);
+void ansi_decode(AnsiDecoder *decoder, const char *text, size_t len, AnsiEmitFunc emit, void *ctx);
+const char* ansi_find_esc(const char *text, size_t len);
+
+#endif
@@ -0,0 +1,209 @@
+/**
+ * @file ansibench.c
+ * @brief ANSI çözücünün doğruluğu ve skaler çözücüye karşı hızı
+ *
+ * ansi.c ikinci kez, ANSI_SCALAR_SCAN ile ve scalar_ önekli adlarla bu
+ * dosyaya içerilir: aynı durum makinesi, ESC araması bayt döngüsüyle.
+ * Uygulamadaki çözücü ise ansi.c'nin ayrıca derlenmiş halidir (glibc'de
+ * memchr, diğerlerinde SSE2). İkisi aynı bayraklarla derlenir (make bench).
+ *
+ * Doğruluk denetimleri (çıktı, aynı stildeki ardışık parçalar birleştirilerek
+ * karşılaştırılır):
+ *   - Örnek satır ve rastgele üretilmiş diziler iki çözücüde aynı çıkar
+ *   - Girdi her konumdan ikiye bölünerek ve bayt bayt verildiğinde çıktı
+ *     tek parça verilmiş halinden farksızdır
+ * Ölçüm: 64 MB düz metin ve ls --color benzeri renkli metin, MB/s.
+ *
+ * Kullanım:
+ *   bench/ansibench [MB]     (varsayılan: 64)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../ansi.h"
+
+#define ANSI_SCALAR_SCAN
+#define ansi_decoder_init scalar_decoder_init
+#define ansi_decode scalar_decode
+#define ansi_find_esc scalar_find_esc
+#include "../ansi.c"
+#undef ansi_decoder_init
+#undef ansi_decode
+#undef ansi_find_esc
+
+typedef void (*DecodeFunc)(AnsiDecoder *decoder, const char *text, size_t len, AnsiEmitFunc emit, void *ctx);
+
+/**
+ * @brief Çözücü çıktısının karşılaştırılabilir metni
+ *
+ * Stil her değiştiğinde "<renk+b+u>" yazılır, ardından metin eklenir;
+ * böylece aynı stildeki parçaların nerede bölündüğü fark yaratmaz.
+ */
+typedef struct {
+    char *data;
+    size_t len, cap;
+    char style[32];  // Son yazılan stil
+    size_t bytes;    // Ölçümde yalnızca sayılan bayt
+} Output;
+
+static void output_append(Output *out, const char *text, size_t len) {
+    if (out->len + len + 1 > out->cap) {
+        out->cap = (out->len + len + 1) * 2;
+        out->data = realloc(out->data, out->cap);
+    }
+    memcpy(out->data + out->len, text, len);
+    out->len += len;
+    out->data[out->len] = '\0';
+}
+
+static void emit_record(void *ctx, const char *text, size_t len, const char *color, int attrs) {
+    Output *out = ctx;
+    char style[32];
+    snprintf(style, sizeof(style), "<%s%s%s>", color ? color : "varsayılan",
+             attrs & ANSI_ATTR_BOLD ? "+b" : "", attrs & ANSI_ATTR_UNDERLINE ? "+u" : "");
+    if (strcmp(style, out->style) != 0) {
+        output_append(out, style, strlen(style));
+        strcpy(out->style, style);
+    }
+    output_append(out, text, len);
+}
+
+static void emit_count(void *ctx, const char *text, size_t len, const char *color, int attrs) {
+    ((Output *)ctx)->bytes += len;
+}
+
+/**
+ * @brief Metni parçalar halinde çözer; step 0 ise tek parça, split > 0 ise o konumdan ikiye bölünür
+ */
+static char* decode_all(DecodeFunc decode, const char *text, size_t len, size_t split, size_t step) {
+    Output out = { 0 };
+    AnsiDecoder d;
+    ansi_decoder_init(&d);
+    output_append(&out, "", 0);
+    if (step) {
+        for (size_t i = 0; i < len; i += step) {
+            size_t chunk = len - i < step ? len - i : step;
+            decode(&d, text + i, chunk, emit_record, &out);
+        }
+    } else if (split) {
+        decode(&d, text, split, emit_record, &out);
+        decode(&d, text + split, len - split, emit_record, &out);
+    } else {
+        decode(&d, text, len, emit_record, &out);
+    }
+    return out.data;
+}
+
+/**
+ * @brief Bir girdiyi iki çözücüde ve tüm bölünmelerde denetler; hatada 0 döndürür
+ */
+static int check(const char *text, size_t len) {
+    char *whole = decode_all(ansi_decode, text, len, 0, 0);
+    char *scalar = decode_all(scalar_decode, text, len, 0, 0);
+    int ok = strcmp(whole, scalar) == 0;
+    if (!ok) fprintf(stderr, "ansibench: skaler çözücü farklı\n  %s\n  %s\n", whole, scalar);
+    for (size_t k = 1; ok && k < len; k++) {
+        char *split = decode_all(ansi_decode, text, len, k, 0);
+        if (strcmp(whole, split) != 0) {
+            fprintf(stderr, "ansibench: %zu. bayttan bölünce farklı\n  %s\n  %s\n", k, whole, split);
+            ok = 0;
+        }
+        free(split);
+    }
+    char *bytewise = decode_all(ansi_decode, text, len, 0, 1);
+    if (ok && strcmp(whole, bytewise) != 0) {
+        fprintf(stderr, "ansibench: bayt bayt verilince farklı\n  %s\n  %s\n", whole, bytewise);
+        ok = 0;
+    }
+    free(whole);
+    free(scalar);
+    free(bytewise);
+    return ok;
+}
+
+/**
+ * @brief Kaçış dizisi parçalarından rastgele bir girdi üretir
+ */
+static size_t random_input(char *buf, size_t size) {
+    static const char *pieces[] = {
+        "a", "metin ", "\n", "\033[0m", "\033[1m", "\033[4m", "\033[22;24m", "\033[31m", "\033[01;34m",
+        "\033[38;5;196m", "\033[38;2;10;200;10m", "\033[48;5;3m", "\033[39m", "\033[m", "\033[2K",
+        "\033[?25l", "\033]0;başlık\007", "\033]2;x\033\\", "\033(B", "\033", "[", "m", ";", "5",
+        "\033[1;2;3;4;5;6;7;8;9;10;11;12;13;14;15;16;17;18;19;20;21;22;23;24;25;26;27;28;29m",
+        "\033[38;5;99999999999m",
+    };
+    size_t len = 0;
+    for (int n = rand() % 24; n > 0; n--) {
+        const char *piece = pieces[rand() % (sizeof(pieces) / sizeof(*pieces))];
+        size_t plen = strlen(piece);
+        if (len + plen >= size) break;
+        memcpy(buf + len, piece, plen);
+        len += plen;
+    }
+    return len;
+}
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Tamponu birkaç kez çözer ve MB/s döndürür
+ */
+static double throughput(DecodeFunc decode, const char *buf, size_t len, size_t expected) {
+    const int rounds = 5;
+    double start = now();
+    for (int r = 0; r < rounds; r++) {
+        Output out = { 0 };
+        AnsiDecoder d;
+        ansi_decoder_init(&d);
+        decode(&d, buf, len, emit_count, &out);
+        if (out.bytes != expected) {
+            fprintf(stderr, "ansibench: %zu bayt metin bekleniyordu, %zu geldi\n", expected, out.bytes);
+            exit(1);
+        }
+    }
+    return rounds * len / (now() - start) / (1024 * 1024);
+}
+
+int main(int argc, char **argv) {
+    size_t mb = argc > 1 ? strtoul(argv[1], NULL, 10) : 64;
+    if (mb == 0) {
+        fprintf(stderr, "Kullanım: %s [MB]\n", argv[0]);
+        return 2;
+    }
+
+    static const char sample[] =
+        "a\033[01;34mdir\033[0m b \033[1;31mRED\033[22mx\033[4mu\033[24m\033[39md \033]0;title\007t "
+        "\033[38;5;196mX\033[38;2;10;200;10mG\033[48;5;3mH\033[0m\033[2K\033(Bz\033[?25lq";
+    int ok = check(sample, strlen(sample));
+    char buf[512];
+    srand(1);
+    for (int i = 0; ok && i < 20000; i++) ok = check(buf, random_input(buf, sizeof(buf)));
+    if (!ok) return 1;
+    printf("doğruluk: örnek satır ve 20000 rastgele girdi; iki çözücü, her bölünme ve bayt bayt aynı\n");
+
+    size_t len = mb * 1024 * 1024;
+    char *data = malloc(len);
+    static const char line[] = "abcdefghij klmnopqrstuvwxyz\n";
+    for (size_t i = 0; i < len; i++) data[i] = line[i % (sizeof(line) - 1)];
+    double fast = throughput(ansi_decode, data, len, len);
+    double scalar = throughput(scalar_decode, data, len, len);
+    printf("düz metin:   %8.0f MB/s  (skaler %6.0f MB/s, %.1fx)\n", fast, scalar, fast / scalar);
+
+    // ls --color benzeri: her ~15 baytta bir renk dizisi
+    static const char colored[] = "\033[01;34msrc\033[0m  \033[01;32mbuild.sh\033[0m  README.md  \033[01;36mlink\033[0m\n";
+    static const char visible[] = "src  build.sh  README.md  link\n";
+    size_t clen = sizeof(colored) - 1, n = len / clen;
+    for (size_t i = 0; i < n; i++) memcpy(data + i * clen, colored, clen);
+    fast = throughput(ansi_decode, data, n * clen, n * (sizeof(visible) - 1));
+    scalar = throughput(scalar_decode, data, n * clen, n * (sizeof(visible) - 1));
+    printf("renkli (ls): %8.0f MB/s  (skaler %6.0f MB/s, %.1fx)\n", fast, scalar, fast / scalar);
+
+    free(data);
+    return 0;
+}
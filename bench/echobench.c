@@ -0,0 +1,53 @@
+/**
+ * @file echobench.c
+ * @brief Yerleşik echo ile fork/exec edilen /bin/echo karşılaştırması
+ *
+ * N kez "echo hi" çalıştırır: önce /bin/echo ile (yerleşik komutlar
+ * eklenmeden önceki yol: her çağrı bir süreç başlatır), sonra yerleşik
+ * echo ile (süreç başlatılmaz). Her komut sekmeye ayrı bir satır olarak
+ * girilir ve bitmesi beklenir; toplamda N satır çıktı geldiği doğrulanır.
+ *
+ * Kullanım:
+ *   bench/echobench [N]     (varsayılan: 10000)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "harness.h"
+
+/**
+ * @brief N kez komutu çalıştırır; geçen süreyi döndürür (çıktı hatalıysa -1)
+ */
+static double run(const char *command, long total) {
+    long lines = 0;
+    gint64 start = g_get_monotonic_time();
+    for (long i = 0; i < total; i++) {
+        harness_run(0, command);
+        if (strcmp(harness_output(), "hi\n") == 0) lines++;
+    }
+    double seconds = harness_elapsed(start);
+    return lines == total ? seconds : -1;
+}
+
+int main(int argc, char **argv) {
+    long total = argc > 1 ? atol(argv[1]) : 10000;
+    if (total <= 0) {
+        fprintf(stderr, "Kullanım: %s [N]\n", argv[0]);
+        return 2;
+    }
+
+    harness_init();
+    double forked = run("/bin/echo hi", total);
+    double builtin = run("echo hi", total);
+    harness_shutdown();
+
+    if (forked < 0 || builtin < 0) {
+        fprintf(stderr, "echobench: beklenen %ld satır gelmedi\n", total);
+        return 1;
+    }
+    printf("önce  (/bin/echo): %ld çağrı, %.3f s, %.1f µs/çağrı\n", total, forked, forked * 1e6 / total);
+    printf("sonra (yerleşik):  %ld çağrı, %.3f s, %.1f µs/çağrı\n", total, builtin, builtin * 1e6 / total);
+    printf("hızlanma:          %.1fx\n", forked / builtin);
+    return 0;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file globbench.c
+ * @brief Büyük bir dizinde joker genişletme hızı
+ *
+ * Geçici bir dizinde N boş dosya (f000000.log, f000001.log, ...) oluşturur,
+ * sekmeyi cd ile oraya taşır ve yerleşik echo ile joker genişletmesini
+ * ölçer: ilk genişletme (dizin taranır), aynı ve farklı desenlerle tekrarlar
+ * (önbellekten), ve dizine bir dosya eklendikten sonraki ilk genişletme
+ * (önbellek geçersiz kılınıp yeniden taranır). Her ölçümde eşleşme sayısı
+ * doğrulanır; dizin sonunda silinir.
+ *
+ * Kullanım:
+ *   bench/globbench [N [tekrar]]     (varsayılan: 200000 100)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "harness.h"
+
+/**
+ * @brief Deseni yerleşik echo ile genişletir; eşleşme sayısını döndürür
+ */
+static long expand(const char *pattern) {
+    char *line = g_strdup_printf("echo %s", pattern);
+    harness_run(0, line);
+    g_free(line);
+    long words = 0;
+    for (const char *p = harness_output(); *p; p++) {
+        if (*p != ' ' && *p != '\n' && (p == harness_output() || p[-1] == ' ')) words++;
+    }
+    return words;
+}
+
+/**
+ * @brief Genişletmeyi süreyle birlikte yazar; eşleşme sayısı beklenenden farklıysa 0 döndürür
+ */
+static int measure(const char *label, const char *pattern, int repeat, long expected) {
+    long matches = 0;
+    gint64 start = g_get_monotonic_time();
+    for (int i = 0; i < repeat; i++) matches = expand(pattern);
+    double usec = (g_get_monotonic_time() - start) / (double)repeat;
+    printf("%10.1f µs  %7ld eşleşme  %-12s %s\n", usec, matches, pattern, label);
+    if (matches != expected) {
+        fprintf(stderr, "globbench: %s için %ld eşleşme bekleniyordu\n", pattern, expected);
+        return 0;
+    }
+    return 1;
+}
+
+int main(int argc, char **argv) {
+    long count = argc > 1 ? atol(argv[1]) : 200000;
+    int repeat = argc > 2 ? atoi(argv[2]) : 100;
+    if (count < 1000 || repeat <= 0) {
+        fprintf(stderr, "Kullanım: %s [N (en az 1000) [tekrar]]\n", argv[0]);
+        return 2;
+    }
+
+    const char *tmp = getenv("TMPDIR") ? getenv("TMPDIR") : "/tmp";
+    char *dir = g_strdup_printf("%s/globbench.XXXXXX", tmp);
+    if (!mkdtemp(dir)) {
+        perror("globbench: mkdtemp");
+        return 2;
+    }
+    gint64 start = g_get_monotonic_time();
+    char name[PATH_MAX];
+    for (long i = 0; i < count; i++) {
+        snprintf(name, sizeof(name), "%s/f%06ld.log", dir, i);
+        int fd = open(name, O_CREAT | O_WRONLY, 0644);
+        if (fd == -1) {
+            perror(name);
+            return 2;
+        }
+        close(fd);
+    }
+    printf("%ld dosya oluşturuldu: %s (%.2f s)\n", count, dir, harness_elapsed(start));
+
+    harness_init();
+    char *cd = g_strdup_printf("cd '%s'", dir);
+    harness_run(0, cd);
+    g_free(cd);
+
+    int ok = 1;
+    ok &= measure("ilk (tarama)", "f001*.log", 1, 1000);
+    ok &= measure("tekrar (önbellek)", "f001*.log", repeat, 1000);
+    ok &= measure("başka desen (önbellek)", "f00?12?.log", repeat, 100);
+    ok &= measure("tümü (önbellek)", "*.log", MAX(repeat / 10, 1), count);
+    snprintf(name, sizeof(name), "%s/f001yeni.log", dir);
+    close(open(name, O_CREAT | O_WRONLY, 0644));
+    ok &= measure("dosya eklendikten sonra", "f001*.log", 1, 1001);
+    ok &= measure("tekrar (önbellek)", "f001*.log", repeat, 1001);
+
+    harness_run(0, "cd /");
+    harness_shutdown();
+
+    unlink(name);
+    for (long i = 0; i < count; i++) {
+        snprintf(name, sizeof(name), "%s/f%06ld.log", dir, i);
+        unlink(name);
+    }
+    if (rmdir(dir) != 0) perror(dir);
+    g_free(dir);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,99 @@
+/**
+ * @file harness.c
+ * @brief Ölçüm programlarının ortak altyapısı
+ *
+ * Model katmanını arayüz olmadan başlatır: komutlar uygulamadaki gibi
+ * model_execute_command ile çalıştırılır, çıktılar output callback'i ile
+ * toplanır ve ana döngü sekme model_tab_busy ile boşa çıkana kadar bu
+ * dosyada döndürülür.
+ */
+
+#include <sys/resource.h>
+#include "harness.h"
+#include "../model.h"
+#include "../launcher.h"
+
+static GString *output = NULL; // Son komutun çıktısı
+static int run_tab = -1;       // Çıktısı toplanan sekme
+static gint64 run_start = 0;   // Son harness_run çağrısının başlangıcı
+static gint64 first_output = 0; // Son komutun ilk çıktısının geldiği an (0 = henüz yok)
+
+/**
+ * @brief Model'in output callback'i: çalışan sekmenin çıktısını biriktirir
+ */
+static void on_output(int tab_index, const char *text, const char *color) {
+    if (tab_index != run_tab) return;
+    if (!first_output) first_output = g_get_monotonic_time();
+    g_string_append(output, text);
+}
+
+/**
+ * @brief Yardımcı süreci ve model katmanını uygulamadaki sırayla başlatır
+ */
+void harness_init(void) {
+    launcher_start_helper(); // Süreç küçükken, main.c'deki gibi
+    model_init();
+    model_set_output_callback(on_output);
+    output = g_string_new(NULL);
+}
+
+/**
+ * @brief Model kaynaklarını ve yardımcı süreci kapatır
+ */
+void harness_shutdown(void) {
+    model_cleanup();
+    launcher_shutdown();
+    g_string_free(output, TRUE);
+    output = NULL;
+}
+
+/**
+ * @brief Komut satırını sekmede çalıştırır ve bitmesini bekler
+ *
+ * @param tab_index Komutun çalışacağı sekme
+ * @param cmdline Komut satırı (boru hattı olabilir)
+ * @return int Komutun çıkış kodu
+ */
+int harness_run(int tab_index, const char *cmdline) {
+    g_string_truncate(output, 0);
+    run_tab = tab_index;
+    first_output = 0;
+    run_start = g_get_monotonic_time();
+    model_execute_command(tab_index, cmdline);
+    while (model_tab_busy(tab_index))
+        g_main_context_iteration(NULL, TRUE);
+    if (!first_output) first_output = g_get_monotonic_time();
+    run_tab = -1;
+    return model_get_last_status(tab_index);
+}
+
+/**
+ * @brief Son harness_run çağrısında toplanan çıktı
+ */
+const char* harness_output(void) {
+    return output->str;
+}
+
+/**
+ * @brief Son harness_run çağrısında komutun girilmesinden ilk çıktının gelmesine
+ * kadar geçen saniye (komut hiç çıktı vermediyse bitişine kadar)
+ */
+double harness_first_output(void) {
+    return (first_output - run_start) / (double)G_USEC_PER_SEC;
+}
+
+/**
+ * @brief g_get_monotonic_time ile alınmış başlangıçtan bu yana geçen saniye
+ */
+double harness_elapsed(gint64 start) {
+    return (g_get_monotonic_time() - start) / (double)G_USEC_PER_SEC;
+}
+
+/**
+ * @brief Ölçüm sürecinin (GUI tarafının) en yüksek yerleşik belleği (KB)
+ */
+long harness_max_rss_kb(void) {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
@@ -0,0 +1,14 @@
+#ifndef BENCH_HARNESS_H
+#define BENCH_HARNESS_H
+
+#include <glib.h>
+
+void harness_init(void);
+void harness_shutdown(void);
+int harness_run(int tab_index, const char *cmdline);
+const char* harness_output(void);
+double harness_first_output(void);
+double harness_elapsed(gint64 start);
+long harness_max_rss_kb(void);
+
+#endif
@@ -0,0 +1,55 @@
+/**
+ * @file pipebench.c
+ * @brief Üç aşamalı boru hattının veri hızı
+ *
+ * "head -c N /dev/zero | cat | wc -c" satırını model üzerinden
+ * çalıştırır, wc'nin saydığı baytın N olduğunu doğrular ve GB/s yazar.
+ * Aşamalar arasındaki veri çekirdekteki borulardan geçer; uygulamanın
+ * kendi CPU süresi bu yüzden veri miktarından bağımsız kalmalıdır ve
+ * ayrıca yazdırılır.
+ *
+ * Kullanım:
+ *   bench/pipebench [GB]     (varsayılan: 4)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+#include "harness.h"
+
+/**
+ * @brief Ölçüm sürecinin şimdiye kadar harcadığı CPU süresi (saniye)
+ */
+static double self_cpu_seconds(void) {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec +
+           (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+}
+
+int main(int argc, char **argv) {
+    double gb = argc > 1 ? atof(argv[1]) : 4;
+    if (gb <= 0) {
+        fprintf(stderr, "Kullanım: %s [GB]\n", argv[0]);
+        return 2;
+    }
+    unsigned long long bytes = (unsigned long long)(gb * 1024 * 1024 * 1024);
+    char *line = g_strdup_printf("head -c %llu /dev/zero | cat | wc -c", bytes);
+
+    harness_init();
+    double cpu_start = self_cpu_seconds();
+    gint64 start = g_get_monotonic_time();
+    int status = harness_run(0, line);
+    double seconds = harness_elapsed(start);
+    double cpu = self_cpu_seconds() - cpu_start;
+
+    int ok = status == 0 && strtoull(harness_output(), NULL, 10) == bytes;
+    printf("komut:        %s\n", line);
+    printf("sonuç:        %s%s", ok ? "" : "HATALI: ", harness_output());
+    printf("süre:         %.2f s  (%.2f GB/s)\n", seconds, bytes / seconds / (1024.0 * 1024 * 1024));
+    printf("uygulama CPU: %.3f s\n", cpu);
+
+    harness_shutdown();
+    g_free(line);
+    return ok ? 0 : 1;
+}
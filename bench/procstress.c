@@ -0,0 +1,85 @@
+/**
+ * @file procstress.c
+ * @brief Süreç tablosu ve toplama için yük testi
+ *
+ * Toplam N komutu W'lik dalgalar halinde arka planda başlatır (her biri ayrı
+ * bir "/bin/true &" satırı) ve her dalganın ardından "wait" ile bitmesini
+ * bekler. Dalga başlatılırken ana döngü pek dönmediğinden işler toplanmaz,
+ * yani bir dalganın W işi aynı anda iş ve process tablosunda durur. Launcher
+ * sayaçlarından gerçekten başlatılan süreç sayısını, çıktıdan da hata
+ * satırlarını denetler; sonunda ps çıktısında çalışır görünen süreç
+ * kalmadığını doğrular, komut/s hızını ve uygulamanın bellek kullanımını yazar.
+ *
+ * Her iş GUI tarafında bir fd (çıktı pipe'ı) tutar; büyük dalgalar için açık
+ * dosya sınırı yumuşak değerden sert değere yükseltilir.
+ *
+ * Kullanım:
+ *   bench/procstress [N [W]]     (varsayılan: 100000 500)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include "harness.h"
+#include "../launcher.h"
+
+#define FDS_PER_JOB 1    // Çıktı pipe'ı
+#define FD_RESERVE 256   // GTK/GLib, yardımcı soketi vb. için pay
+
+int main(int argc, char **argv) {
+    long total = argc > 1 ? atol(argv[1]) : 100000;
+    int wave = argc > 2 ? atoi(argv[2]) : 500;
+    if (total <= 0 || wave <= 0) {
+        fprintf(stderr, "Kullanım: %s [N [W]]\n", argv[0]);
+        return 2;
+    }
+
+    struct rlimit nofile;
+    getrlimit(RLIMIT_NOFILE, &nofile);
+    nofile.rlim_cur = nofile.rlim_max;
+    setrlimit(RLIMIT_NOFILE, &nofile);
+    if (nofile.rlim_cur != RLIM_INFINITY &&
+        (rlim_t)wave * FDS_PER_JOB + FD_RESERVE > nofile.rlim_cur) {
+        fprintf(stderr, "%d'lik dalga için açık dosya sınırı (%lu) yetersiz\n",
+                wave, (unsigned long)nofile.rlim_cur);
+        return 2;
+    }
+
+    harness_init();
+    long rss_start = harness_max_rss_kb();
+    unsigned long spawned_start = launcher_get_stats()->count;
+    int failed = 0;
+    int errors = 0;
+    gint64 start = g_get_monotonic_time();
+    for (long done = 0; done < total; done += wave) {
+        long n = MIN(wave, total - done);
+        int wave_error = 0;
+        for (long i = 0; i < n; i++) {
+            harness_run(0, "/bin/true &");
+            // Başlatılamayan işler dalgayı bozmaz ("wait" yine 0 döner), yalnızca çıktıda görünür
+            if (!wave_error && strstr(harness_output(), "[Hata:")) {
+                if (errors == 0) fprintf(stderr, "ilk hata çıktısı:\n%s", harness_output());
+                wave_error = 1;
+            }
+        }
+        errors += wave_error;
+        if (harness_run(0, "wait") != 0) failed++;
+    }
+    double seconds = harness_elapsed(start);
+    unsigned long spawned = launcher_get_stats()->count - spawned_start;
+
+    harness_run(0, "ps");
+    int running = 0;
+    for (const char *p = harness_output(); (p = strstr(p, "\tRUNNING\t")); p++) running++;
+
+    printf("komut:        %ld (%d'lik dalgalar)\n", total, wave);
+    printf("süre:         %.2f s  (%.0f komut/s)\n", seconds, total / seconds);
+    printf("başlatılan:   %lu süreç\n", spawned);
+    printf("başarısız:    %d dalga (%d dalgada hata satırı)\n", failed, errors);
+    printf("çalışan:      %d (ps)\n", running);
+    printf("bellek:       %ld KB -> %ld KB (en yüksek RSS)\n", rss_start, harness_max_rss_kb());
+
+    harness_shutdown();
+    return failed == 0 && errors == 0 && running == 0 && spawned == (unsigned long)total ? 0 : 1;
+}
@@ -0,0 +1,146 @@
+/**
+ * @file spawnbench.c
+ * @brief Süreç başlatma yollarının karşılaştırması: fork+execvp ve launcher
+ *
+ * Aynı "true" komutunu N kez, her seferinde bir önceki bitince başlatır:
+ *
+ * - fork+execvp: launcher'dan önceki yol; büyük süreçte fork sayfa
+ *   tablolarını kopyaladığı için yavaşlar
+ * - yardımcı: launcher_spawn, süreç küçükken fork edilmiş yardımcı üzerinden
+ * - posix_spawn: launcher_spawn, yardımcı kapatıldıktan sonraki doğrudan yol
+ *
+ * GUI sürecinin boyutunu taklit etmek için ölçümden önce MB kadar bellek
+ * ayrılıp dokunulur (yardımcı bundan önce başlatılır, main.c'deki gibi).
+ * Her çocuğun 0 ile çıktığı doğrulanır; başlatma başına µs yazılır. Launcher
+ * yollarında ayrıca launcher'ın kendi ölçtüğü başlatma süresi (çocuğun
+ * çalışması hariç) verilir.
+ *
+ * Kullanım:
+ *   bench/spawnbench [N [MB]]     (varsayılan: 1000 256)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <glib.h>
+#include "../launcher.h"
+
+static char *const true_argv[] = { "true", NULL };
+static int exited = 0;   // Son başlatılan çocuk toplandı mı
+static int exit_ok = 0;  // ... ve 0 ile mi çıktı
+
+/**
+ * @brief Launcher'ın çıkış callback'i: çocuğun çıkış durumunu kaydeder
+ */
+static void on_child_exit(pid_t pid, int status, const LaunchUsage *usage, void *user_data) {
+    exited = 1;
+    exit_ok = status != -1 && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+/**
+ * @brief fork+execvp ile N kez başlatır; başarısız çocuk sayısını döndürür
+ */
+static long run_fork(long total, double *seconds) {
+    long failed = 0;
+    gint64 start = g_get_monotonic_time();
+    for (long i = 0; i < total; i++) {
+        pid_t pid = fork();
+        if (pid == 0) {
+            execvp(true_argv[0], true_argv);
+            _exit(127);
+        }
+        int status;
+        if (pid == -1 || waitpid(pid, &status, 0) != pid ||
+            !WIFEXITED(status) || WEXITSTATUS(status) != 0) failed++;
+    }
+    *seconds = (g_get_monotonic_time() - start) / (double)G_USEC_PER_SEC;
+    return failed;
+}
+
+/**
+ * @brief launcher_spawn ile N kez başlatır; başarısız çocuk sayısını döndürür
+ */
+static long run_launcher(long total, double *seconds) {
+    LaunchSpec spec = {
+        .argv = true_argv,
+        .path = NULL,
+        .stdin_fd = -1,
+        .stdout_fd = -1,
+        .stderr_fd = -1,
+        .pgid = -1,
+        .cwd_fd = -1,
+    };
+    long failed = 0;
+    gint64 start = g_get_monotonic_time();
+    for (long i = 0; i < total; i++) {
+        exited = 0;
+        if (launcher_spawn(&spec, on_child_exit, NULL, NULL) == -1) {
+            failed++;
+            continue;
+        }
+        while (!exited) g_main_context_iteration(NULL, TRUE);
+        if (!exit_ok) failed++;
+    }
+    *seconds = (g_get_monotonic_time() - start) / (double)G_USEC_PER_SEC;
+    return failed;
+}
+
+/**
+ * @brief Bir yolun sonucunu yazar; launcher yollarında kendi ölçtüğü ortalamayı da
+ */
+static void report(const char *label, long total, double seconds, long failed,
+                   const LaunchStats *before, const LaunchStats *after) {
+    printf("%-13s %ld başlatma, %.3f s, %.1f µs/başlatma", label, total, seconds, seconds * 1e6 / total);
+    if (before && after->count > before->count) {
+        printf("  (launcher ort %.1f µs)",
+               (after->total_ns - before->total_ns) / 1000.0 / (after->count - before->count));
+    }
+    printf("%s\n", failed ? "  HATALI" : "");
+    if (failed) fprintf(stderr, "spawnbench: %s: %ld çocuk 0 ile çıkmadı\n", label, failed);
+}
+
+int main(int argc, char **argv) {
+    long total = argc > 1 ? atol(argv[1]) : 1000;
+    long ballast_mb = argc > 2 ? atol(argv[2]) : 256;
+    if (total <= 0 || ballast_mb < 0) {
+        fprintf(stderr, "Kullanım: %s [N [MB]]\n", argv[0]);
+        return 2;
+    }
+
+    launcher_start_helper(); // Süreç küçükken, main.c'deki gibi
+    size_t ballast_len = (size_t)ballast_mb << 20;
+    char *ballast = ballast_len ? g_malloc(ballast_len) : NULL;
+    if (ballast) memset(ballast, 1, ballast_len); // Sayfalar gerçekten ayrılsın
+
+    double seconds;
+    LaunchStats before, after;
+    long failed = 0, n;
+    printf("GUI boyutu:   +%ld MB\n", ballast_mb);
+
+    n = run_fork(total, &seconds);
+    report("fork+execvp:", total, seconds, n, NULL, NULL);
+    failed += n;
+
+    before = *launcher_get_stats();
+    n = run_launcher(total, &seconds);
+    after = *launcher_get_stats();
+    if (after.via_helper - before.via_helper != (unsigned long)total) {
+        fprintf(stderr, "spawnbench: yardımcı yolu kullanılmadı (%lu/%ld)\n",
+                after.via_helper - before.via_helper, total);
+        n = total;
+    }
+    report("yardımcı:", total, seconds, n, &before, &after);
+    failed += n;
+
+    launcher_shutdown(); // Bundan sonra launcher_spawn doğrudan posix_spawn kullanır
+    before = *launcher_get_stats();
+    n = run_launcher(total, &seconds);
+    after = *launcher_get_stats();
+    report("posix_spawn:", total, seconds, n, &before, &after);
+    failed += n;
+
+    g_free(ballast);
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,55 @@
+/**
+ * @file tokbench.c
+ * @brief Komut satırı ayrıştırıcısının (tokenize) hızı
+ *
+ * model.c doğrudan içerilir ve static tokenize gerçek komut satırları
+ * üzerinde döngüde çağrılır. Genişletmesiz (tab_index = -1) ve değişken
+ * genişletmeli (tab_index = 0) iki ölçüm yapılır; sonuç milyon belirteç/s ve
+ * satır başına ns olarak yazılır.
+ *
+ * Kullanım:
+ *   bench/tokbench [yineleme]     (varsayılan: 3000000)
+ */
+
+#include "../model.c"
+
+static const char *lines[] = {
+    "cat test.txt | grep burak | wc -l",
+    "grep 'burak oyunda' test.txt > out.txt 2>&1",
+    "echo \"a b\" c\\ d 'e f' | sort | uniq -c",
+    "sort < test.txt >> sirali.txt 2>> hata.log",
+    "printf '%s %s\\n' \"$USER\" \"$HOME\" | tee -a kim.txt",
+};
+
+/**
+ * @brief Satırları sırayla ayrıştırır ve hızı yazar
+ */
+static void run(const char *label, int tab_index, long iterations) {
+    long tokens = 0;
+    gint64 start = g_get_monotonic_time();
+    for (long it = 0; it < iterations; it++) {
+        TokenList t;
+        const char *error;
+        if (tokenize(lines[it % G_N_ELEMENTS(lines)], tab_index, &t, &error) != 0) {
+            fprintf(stderr, "tokbench: %s\n", error);
+            exit(1);
+        }
+        tokens += t.argc;
+        token_list_free(&t);
+    }
+    double usec = g_get_monotonic_time() - start;
+    printf("%s\t%ld satır, %ld belirteç, %.3f s: %.1f M belirteç/s, %.0f ns/satır\n", label,
+           iterations, tokens, usec / 1e6, tokens / usec, usec * 1000 / iterations);
+}
+
+int main(int argc, char **argv) {
+    long iterations = argc > 1 ? atol(argv[1]) : 3000000;
+    if (iterations <= 0) {
+        fprintf(stderr, "Kullanım: %s [yineleme]\n", argv[0]);
+        return 2;
+    }
+    model_init();
+    run("genişletmesiz:", -1, iterations);
+    run("değişkenli:", 0, iterations);
+    return 0;
+}
@@ -0,0 +1,195 @@
+/**
+ * @file tokfuzz.c
+ * @brief Komut satırı ayrıştırıcısı (tokenize) için bulanık test
+ *
+ * model.c doğrudan içerilir; böylece static tokenize, token_list_free ve
+ * append_quoted çağrılabilir. Girdiler iki kaynaktan üretilir: işleç ve
+ * tırnak karakterlerinden oluşan rastgele satırlar, ve gerçek komut
+ * satırlarının (test.txt üzerinde kullanılanlar gibi) rastgele karakter
+ * ekleme/silme/değiştirme ile bozulmuş halleri.
+ *
+ * Genişletmesiz ayrıştırmada (tab_index = -1) denetlenenler:
+ *   - argv NULL ile biter, belirteçler NULL değildir
+ *   - TOKEN_OP belirteçleri operator_length'in tamamını tanıdığı işleçlerdir
+ *   - Sözcükler append_quoted ile tırnaklanıp yeniden ayrıştırıldığında aynı
+ *     belirteçler ve aynı işleç bayrakları çıkar
+ * Genişletmeli ayrıştırmada (tab_index = 0, değişkenler ve jokerler geçici
+ * bir dizinde) yalnızca yapı denetlenir; bellek hataları için ASan ile
+ * derlenir (make tokfuzz).
+ *
+ * Kullanım:
+ *   bench/tokfuzz [yineleme [tohum]]     (varsayılan: 1000000 1)
+ */
+
+#include "../model.c"
+
+#define MAX_LINE 96
+
+static const char *seeds[] = {
+    "cat test.txt | grep burak | wc -l",
+    "grep 'burak oyunda' test.txt > out.txt 2>&1",
+    "echo \"a b\" c\\ d 'e f' | sort | uniq -c",
+    "sort < test.txt >> sirali.txt 2>> hata.log &",
+    "A=1 B='x y' env | grep -v PATH && echo $A || echo ${B}",
+    "ls *.c alt/**/*.c [ab]?.o 2>/dev/null | head -n 3 &> liste",
+    "printf '%s\\n' \"$HOME\" 'it'\\''s' \"\" ''",
+    "make 2>&1 | tee build.log; echo $?",
+};
+
+static guint32 rng_state;
+
+static guint32 rng(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+/**
+ * @brief Rastgele bir satır üretir: yarı yarıya sıfırdan veya bir tohumdan
+ */
+static void make_line(char *line) {
+    static const char alpha[] = " \t'\"\\|&<>12ab=$*?[]{}_.";
+    int n;
+    if (rng() % 2) {
+        n = rng() % (MAX_LINE / 2);
+        for (int i = 0; i < n; i++) line[i] = alpha[rng() % (sizeof(alpha) - 1)];
+    } else {
+        const char *seed = seeds[rng() % G_N_ELEMENTS(seeds)];
+        n = strlen(seed);
+        memcpy(line, seed, n);
+        for (int edits = 1 + rng() % 4; edits > 0; edits--) {
+            int at = n ? rng() % n : 0;
+            char c = alpha[rng() % (sizeof(alpha) - 1)];
+            switch (rng() % 3) {
+            case 0: // Ekle
+                if (n + 1 >= MAX_LINE) break;
+                memmove(line + at + 1, line + at, n - at);
+                line[at] = c;
+                n++;
+                break;
+            case 1: // Sil
+                if (!n) break;
+                memmove(line + at, line + at + 1, n - at - 1);
+                n--;
+                break;
+            default: // Değiştir
+                if (n) line[at] = c;
+            }
+        }
+    }
+    line[n] = '\0';
+}
+
+static void fail(const char *what, const char *line, const char *detail) {
+    fprintf(stderr, "tokfuzz: %s\n  satır: [%s]\n  %s\n", what, line, detail ? detail : "");
+    abort();
+}
+
+/**
+ * @brief Belirteç listesinin yapısını denetler
+ */
+static void check_structure(const char *line, const TokenList *t) {
+    if (t->argv[t->argc] != NULL) fail("argv NULL ile bitmiyor", line, NULL);
+    for (int i = 0; i < t->argc; i++) {
+        if (!t->argv[i]) fail("NULL belirteç", line, NULL);
+        if ((t->flags[i] & TOKEN_OP) && operator_length(t->argv[i]) != strlen(t->argv[i]))
+            fail("işleç belirteci işleç değil", line, t->argv[i]);
+    }
+}
+
+/**
+ * @brief Sözcükleri tırnaklayıp yeniden ayrıştırır, aynı listenin çıktığını denetler
+ */
+static void check_roundtrip(const char *line, const TokenList *t) {
+    GString *requoted = g_string_new(NULL);
+    for (int i = 0; i < t->argc; i++) {
+        if (i) g_string_append_c(requoted, ' ');
+        if (t->flags[i] & TOKEN_OP) g_string_append(requoted, t->argv[i]);
+        else append_quoted(requoted, t->argv[i]);
+    }
+    TokenList u;
+    const char *error;
+    if (tokenize(requoted->str, -1, &u, &error) != 0) fail("tırnaklanan satır ayrıştırılamadı", line, requoted->str);
+    if (u.argc != t->argc) fail("belirteç sayısı değişti", line, requoted->str);
+    for (int i = 0; i < t->argc; i++) {
+        if (strcmp(u.argv[i], t->argv[i]) || (u.flags[i] & TOKEN_OP) != (t->flags[i] & TOKEN_OP))
+            fail("belirteç değişti", line, requoted->str);
+    }
+    token_list_free(&u);
+    g_string_free(requoted, TRUE);
+}
+
+/**
+ * @brief Satırda kökten başlayabilecek bir "**" deseni olup olmadığını söyler
+ *
+ * Bozulan örnek sözcükteki "alt" silinir veya tanımsız bir değişkene
+ * dönüşürse "**" kökten başlar ve genişletme tüm dosya sistemini tarar; bu
+ * satırlar yalnızca genişletmesiz ayrıştırılır.
+ */
+static int rooted_recursive(const char *line) {
+    const char *p = strstr(line, "/**");
+    if (p && strchr(line, '$')) return 1;
+    for (; p; p = strstr(p + 1, "/**")) {
+        if (p == line || !isalnum((unsigned char)p[-1])) return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Joker ve değişken genişletmesi için geçici bir dizin hazırlar
+ */
+static char* setup_dir(void) {
+    char *dir = g_strdup("/tmp/tokfuzz.XXXXXX");
+    if (!mkdtemp(dir) || chdir(dir) != 0) {
+        perror("tokfuzz: geçici dizin");
+        exit(2);
+    }
+    static const char *files[] = { "a.c", "b.c", "ab.o", "[x].txt", "s p.c", "1", ".gizli" };
+    for (size_t i = 0; i < G_N_ELEMENTS(files); i++) close(open(files[i], O_CREAT | O_WRONLY, 0644));
+    mkdir("alt", 0755);
+    close(open("alt/c.c", O_CREAT | O_WRONLY, 0644));
+    return dir;
+}
+
+int main(int argc, char **argv) {
+    long iterations = argc > 1 ? atol(argv[1]) : 1000000;
+    rng_state = argc > 2 ? (guint32)atol(argv[2]) : 1;
+    if (iterations <= 0 || rng_state == 0) {
+        fprintf(stderr, "Kullanım: %s [yineleme [tohum]]\n", argv[0]);
+        return 2;
+    }
+
+    char *dir = setup_dir();
+    model_init();
+    var_set(0, "A", "x y", 0);
+    var_set(0, "B", "*.c", 0);
+    var_set(0, "E", "", 0);
+
+    long tokens = 0, rejected = 0;
+    char line[MAX_LINE + 1];
+    for (long it = 0; it < iterations; it++) {
+        make_line(line);
+        TokenList t;
+        const char *error;
+        if (tokenize(line, -1, &t, &error) == 0) {
+            check_structure(line, &t);
+            check_roundtrip(line, &t);
+            tokens += t.argc;
+            token_list_free(&t);
+        } else {
+            rejected++;
+        }
+        if (!rooted_recursive(line) && tokenize(line, 0, &t, &error) == 0) {
+            check_structure(line, &t);
+            token_list_free(&t);
+        }
+    }
+    printf("tokfuzz: %ld satır, %ld belirteç, %ld kapanmamış tırnak; hata yok\n", iterations, tokens, rejected);
+
+    char *rm = g_strdup_printf("rm -rf '%s'", dir);
+    if (system(rm) != 0) fprintf(stderr, "tokfuzz: %s silinemedi\n", dir);
+    g_free(rm);
+    g_free(dir);
+    return 0;
+}
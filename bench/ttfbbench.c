@@ -0,0 +1,117 @@
+/**
+ * @file ttfbbench.c
+ * @brief Pipe ve PTY çıktı kiplerinde ilk bayt süresi (time-to-first-byte)
+ *
+ * Aynı komutu önce "outmode pipe", sonra "outmode pty" ile N kez çalıştırır
+ * ve her çalıştırmada komutun girilmesinden sekmeye ilk çıktının gelmesine
+ * kadar geçen süreyi ölçer. Varsayılan komut, ilk satırı hemen yazıp bir süre
+ * daha çalışan geçici bir betiği sed'e bağlayan boru hattıdır; sed, stdout'u
+ * pipe iken çıktısını çıkışa kadar tamponda tutar, terminalde ise satır satır
+ * yazar.
+ * Her çalıştırmanın 0 ile bittiği ve çıktının beklenen metni içerdiği
+ * doğrulanır; kip başına en kısa / ortanca / ortalama / en uzun süre yazılır.
+ *
+ * Kullanım:
+ *   bench/ttfbbench [N [komut beklenen]]
+ *   (varsayılan: 20 "sh BETİK | sed s/x/y/" y; BETİK: "echo x; sleep 0.2")
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "harness.h"
+
+static gint compare_double(gconstpointer a, gconstpointer b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return x < y ? -1 : x > y;
+}
+
+/**
+ * @brief Komutu verilen kipte N kez çalıştırıp ilk bayt sürelerini yazar
+ *
+ * @return int Tüm çalıştırmalar başarılıysa 0
+ */
+static int run_mode(const char *mode, const char *command, const char *expect, int total) {
+    char *select = g_strdup_printf("outmode %s", mode);
+    harness_run(0, select);
+    g_free(select);
+
+    GArray *times = g_array_new(FALSE, FALSE, sizeof(double));
+    int failed = 0;
+    double sum = 0;
+    for (int i = 0; i < total; i++) {
+        int status = harness_run(0, command);
+        if (status != 0 || !strstr(harness_output(), expect)) {
+            if (failed++ == 0) fprintf(stderr, "ttfbbench: %s: çıkış %d, çıktı:\n%s", mode, status, harness_output());
+            continue;
+        }
+        double t = harness_first_output();
+        g_array_append_val(times, t);
+        sum += t;
+    }
+
+    guint n = times->len;
+    if (n > 0) {
+        g_array_sort(times, compare_double);
+        double *v = (double *)times->data;
+        printf("%-5s %3u ölçüm  min %7.2f ms  ortanca %7.2f ms  ort %7.2f ms  maks %7.2f ms%s\n",
+               mode, n, v[0] * 1000, v[n / 2] * 1000, sum / n * 1000, v[n - 1] * 1000,
+               failed ? "  HATALI" : "");
+    } else {
+        printf("%-5s ölçüm yok  HATALI\n", mode);
+    }
+    g_array_free(times, TRUE);
+    return failed;
+}
+
+/**
+ * @brief Varsayılan komutun çalıştırdığı betiği geçici dizine yazar
+ *
+ * @return char* Betiğin yolu (g_free ile), hata durumunda NULL
+ */
+static char* write_script(void) {
+    char *path = g_strdup_printf("%s/ttfbbench-XXXXXX", g_get_tmp_dir());
+    int fd = mkstemp(path);
+    static const char body[] = "echo x\nsleep 0.2\n";
+    if (fd == -1 || write(fd, body, sizeof(body) - 1) != sizeof(body) - 1) {
+        perror("ttfbbench: betik yazılamadı");
+        if (fd != -1) {
+            close(fd);
+            unlink(path);
+        }
+        g_free(path);
+        return NULL;
+    }
+    close(fd);
+    return path;
+}
+
+int main(int argc, char **argv) {
+    int total = argc > 1 ? atoi(argv[1]) : 20;
+    if (total <= 0 || argc == 3 || argc > 4) {
+        fprintf(stderr, "Kullanım: %s [N [komut beklenen]]\n", argv[0]);
+        return 2;
+    }
+    char *script = NULL;
+    char *command;
+    if (argc > 3) {
+        command = g_strdup(argv[2]);
+    } else {
+        // Komut satırında tırnak yok; betik ayrı dosyada durur
+        if (!(script = write_script())) return 1;
+        command = g_strdup_printf("sh %s | sed s/x/y/", script);
+    }
+    const char *expect = argc > 3 ? argv[3] : "y";
+
+    harness_init();
+    printf("komut: %s\n", command);
+    int failed = run_mode("pipe", command, expect, total);
+    failed += run_mode("pty", command, expect, total);
+    harness_run(0, "outmode pipe");
+    harness_shutdown();
+    if (script) unlink(script);
+    g_free(script);
+    g_free(command);
+    return failed == 0 ? 0 : 1;
+}
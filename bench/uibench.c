@@ -0,0 +1,206 @@
+/**
+ * @file uibench.c
+ * @brief Arayüz ölçümleri: kare süreleri ve çıktı çizim hızı
+ *
+ * Uygulamanın kendisini (controller_start) açar ve ilk sekmenin çıktı
+ * alanına bir tick callback ekler.
+ *
+ * latency: Ardışık kareler arasındaki süreyi önce boştayken, sonra komut
+ * çalışırken ölçer. Komut ana döngüyü bloklarsa kareler gecikir ve p99 / en
+ * uzun aralık büyür; asenkron yürütmede iki ölçüm yakın kalır. Komutun
+ * bittiği model_tab_busy ile anlaşılır.
+ *
+ * render: "cat DOSYA" çıktısının metin tamponuna eklenme hızını (MB/s) ve
+ * bu sırada kare sürelerini ölçer. Model her komutun yalnızca ilk 100 KB'ını
+ * sekmeye canlı aktarır (fazlası diske yazılır), bu yüzden dosya bu pencereye
+ * sığmalıdır; toplam veri "cat DOSYA; cat DOSYA; ..." ile TEKRAR kez
+ * gönderilir. Hız, tampona gerçekten eklenen baytlardan hesaplanır ve eklenen
+ * bayt beklenenden azsa ölçüm başarısız sayılır. Model komutu bitirdikten
+ * sonra arayüz bekleyen çıktıyı sonraki karelerde yazar; ölçüm beklenen bayt
+ * tampona eklenince (en fazla SETTLE_FRAMES kare sonra) biter.
+ *
+ * Kullanım:
+ *   bench/uibench latency [komut]     (varsayılan: "find / -xdev")
+ *   bench/uibench render DOSYA [TEKRAR]   (varsayılan: toplam ~64 MB)
+ *
+ * Ekran gerektirir (sunucuda: xvfb-run bench/uibench latency). Uygulama
+ * başka bir kopyası açıkken çalıştırılmamalıdır; GtkApplication etkinleştirmeyi
+ * o kopyaya iletir.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <gtk/gtk.h>
+#include "../controller.h"
+#include "../model.h"
+#include "../view.h"
+#include "../launcher.h"
+
+#define IDLE_USEC (1 * G_USEC_PER_SEC)      // Boşta ölçüm süresi
+#define RUN_TIMEOUT_USEC (300 * G_USEC_PER_SEC) // Komut bu sürede bitmezse ölçüm kesilir
+#define SETTLE_FRAMES 30                    // Komut bittikten sonra çıktının tampona gelmesi için beklenen kare
+#define RENDER_WINDOW_BYTES 100000          // Model'in sekmeye aktardığı pencere (MAX_OUTPUT_BYTES)
+#define RENDER_TOTAL_BYTES (64 << 20)       // render: TEKRAR verilmezse hedeflenen toplam
+
+enum { PHASE_WAIT, PHASE_IDLE, PHASE_RUN, PHASE_DONE };
+
+static const char *command = "find / -xdev";
+static int render_mode = 0;        // render: zaman çıktının eklenme hızı için ölçülür
+static gint64 file_size = 0;       // render: cat edilen dosyanın boyutu
+static long repeats = 1;           // render: dosyanın kaç kez cat edileceği
+static const char *render_label = NULL; // render: komut yerine yazdırılan kısa açıklama
+static guint64 inserted = 0;       // render: tampona eklenen bayt
+static int phase = PHASE_WAIT;
+static int settle = 0;             // Komut bittikten sonra geçen kare
+static gint64 phase_start = 0;
+static gint64 last_tick = 0;
+static GArray *intervals = NULL;   // Geçerli aşamadaki kare aralıkları (µs)
+static int exit_code = 0;
+
+static gint compare_interval(gconstpointer a, gconstpointer b) {
+    gint64 x = *(const gint64 *)a, y = *(const gint64 *)b;
+    return x < y ? -1 : x > y;
+}
+
+/**
+ * @brief Aralıkları sıralayıp p50 / p99 / en uzun değerlerini yazar
+ */
+static void report(const char *label) {
+    guint n = intervals->len;
+    if (n == 0) {
+        printf("%-16s kare yok\n", label);
+        return;
+    }
+    g_array_sort(intervals, compare_interval);
+    gint64 *v = (gint64 *)intervals->data;
+    printf("%-16s %5u kare  p50 %6.1f ms  p99 %6.1f ms  en uzun %7.1f ms\n", label, n,
+           v[n / 2] / 1000.0, v[(n * 99) / 100] / 1000.0, v[n - 1] / 1000.0);
+}
+
+/**
+ * @brief Ölçümü bitirir ve uygulamayı kapatır
+ */
+static void finish(int code) {
+    phase = PHASE_DONE;
+    exit_code = code;
+    g_application_quit(g_application_get_default());
+}
+
+/**
+ * @brief Komutu ilk sekmeye girer ve ölçümü başlatır
+ */
+static void start_command(gint64 now) {
+    g_array_set_size(intervals, 0);
+    phase = PHASE_RUN;
+    phase_start = now;
+    printf("komut: %s\n", render_label ? render_label : command);
+    on_user_input(0, command);
+}
+
+/**
+ * @brief Komut bittiğinde süreyi, render'da ayrıca eklenen baytı ve hızı yazar
+ */
+static void command_done(gint64 now) {
+    guint64 expected = (guint64)file_size * repeats;
+    double seconds = (now - phase_start) / 1e6;
+    printf("komut süresi:    %.2f s\n", seconds);
+    if (render_mode) {
+        printf("eklenen:         %llu bayt (beklenen %llu = %lld x %ld)\n", (unsigned long long)inserted,
+               (unsigned long long)expected, (long long)file_size, repeats);
+        printf("hız:             %.1f MB/s\n", inserted / seconds / (1024 * 1024));
+    }
+    report("komut sürerken:");
+    finish(inserted >= expected ? 0 : 1);
+}
+
+/**
+ * @brief Her karede çağrılır: bir önceki kareden bu yana geçen süreyi kaydeder
+ */
+static gboolean on_tick(GtkWidget *widget, GdkFrameClock *clock, gpointer user_data) {
+    gint64 now = g_get_monotonic_time();
+    if (last_tick) g_array_append_val(intervals, (gint64){ now - last_tick });
+    last_tick = now;
+
+    if (phase == PHASE_IDLE && now - phase_start >= IDLE_USEC) {
+        report("boşta:");
+        start_command(now);
+    } else if (phase == PHASE_RUN && !model_tab_busy(0)) {
+        // Arayüz son çıktıyı bu karede yazmış olabilir; render'da hepsi gelene kadar beklenir
+        if (!render_mode || inserted >= (guint64)file_size * repeats || ++settle >= SETTLE_FRAMES)
+            command_done(now);
+    } else if (phase == PHASE_RUN && now - phase_start >= RUN_TIMEOUT_USEC) {
+        report("komut (kesildi):");
+        finish(1);
+    }
+    return phase == PHASE_DONE ? G_SOURCE_REMOVE : G_SOURCE_CONTINUE;
+}
+
+/**
+ * @brief Çıktı tamponuna metin eklendiğinde baytları sayar
+ */
+static void on_insert_text(GtkTextBuffer *buffer, GtkTextIter *location, char *text, int len, gpointer user_data) {
+    if (phase == PHASE_RUN) inserted += len;
+}
+
+/**
+ * @brief İlk sekme ekrana gelene kadar bekler, sonra ölçümü başlatır
+ */
+static gboolean begin(gpointer user_data) {
+    GtkWidget *output = view_get_output_widget(0);
+    if (!output || !gtk_widget_get_mapped(output)) return G_SOURCE_CONTINUE;
+    if (!GTK_IS_TEXT_VIEW(output)) {
+        fprintf(stderr, "uibench: ilk sekme metin görünümü değil\n");
+        finish(2);
+        return G_SOURCE_REMOVE;
+    }
+    intervals = g_array_new(FALSE, FALSE, sizeof(gint64));
+    g_signal_connect_after(gtk_text_view_get_buffer(GTK_TEXT_VIEW(output)), "insert-text",
+                           G_CALLBACK(on_insert_text), NULL);
+    gtk_widget_add_tick_callback(output, on_tick, NULL, NULL);
+    if (render_mode) {
+        start_command(g_get_monotonic_time());
+    } else {
+        phase = PHASE_IDLE;
+        phase_start = g_get_monotonic_time();
+    }
+    return G_SOURCE_REMOVE;
+}
+
+int main(int argc, char **argv) {
+    struct stat st;
+    if (argc >= 2 && strcmp(argv[1], "latency") == 0) {
+        if (argc > 2) command = argv[2];
+    } else if ((argc == 3 || argc == 4) && strcmp(argv[1], "render") == 0 && stat(argv[2], &st) == 0) {
+        render_mode = 1;
+        file_size = st.st_size;
+        if (file_size == 0 || file_size > RENDER_WINDOW_BYTES) {
+            fprintf(stderr, "uibench: dosya boş olmamalı ve %d baytlık sekme penceresine sığmalı\n",
+                    RENDER_WINDOW_BYTES);
+            return 2;
+        }
+        repeats = argc == 4 ? atol(argv[3]) : MAX(1, RENDER_TOTAL_BYTES / file_size);
+        if (repeats <= 0) {
+            fprintf(stderr, "uibench: TEKRAR pozitif olmalı\n");
+            return 2;
+        }
+        GString *line = g_string_new(NULL);
+        for (long i = 0; i < repeats; i++) {
+            g_string_append_printf(line, "%scat '%s'", i ? "; " : "", argv[2]);
+        }
+        command = g_string_free(line, FALSE);
+        render_label = g_strdup_printf("cat '%s' x %ld", argv[2], repeats);
+    } else {
+        fprintf(stderr, "Kullanım: %s latency [komut]\n       %s render DOSYA [TEKRAR]\n", argv[0], argv[0]);
+        return 2;
+    }
+
+    launcher_start_helper();
+    model_init_shared_memory();
+    g_timeout_add(50, begin, NULL);
+    controller_start(1, argv); // Ana döngü; finish() ile döner
+    model_cleanup();
+    launcher_shutdown();
+    return exit_code;
+}
@@ -8,6 +8,7 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 #include <gtk/gtk.h>  // GTK fonksiyonları için gerekli
@@ -17,24 +18,28 @@
 #include <time.h>     // Tarih ve zaman fonksiyonları için gerekli
 
 #define MAX_CMD_LEN 256
-#define MAX_TABS 10 // Maksimum sekme sayısı
 
 // İleri bildirimler (Forward Declarations)
-static void show_help(int tab_index);
-static void show_date(int tab_index);
-static void show_whoami(int tab_index);
-static void show_uptime(int tab_index);
-static void show_joke(int tab_index);
-static void handle_cd_command(int tab_index, const char *path);
+static void clear_terminal(int tab_index, const char *args, int background);
+static void show_help(int tab_index, const char *args, int background);
+static void show_version(int tab_index, const char *args, int background);
+static void show_date(int tab_index, const char *args, int background);
+static void show_whoami(int tab_index, const char *args, int background);
+static void show_uptime(int tab_index, const char *args, int background);
+static void show_joke(int tab_index, const char *args, int background);
+static void show_meminfo(int tab_index, const char *args, int background);
+static void set_scrollback(int tab_index, const char *args, int background);
+static void set_output_view(int tab_index, const char *args, int background);
 static gboolean check_messages(gpointer user_data);
 
 /**
  * @brief Kullanıcı girişlerini işleyen ana fonksiyon
  * 
  * View katmanından gelen girişleri işleyip uygun işlemleri gerçekleştirir:
- * - Özel komutları (clear, help, version vb.) tanır ve işler
  * - Mesajları (@msg ile başlayan) ayrıştırır ve gönderir
- * - Normal shell komutlarını model_execute_command() ile çalıştırır
+ * - Diğer her şeyi model_execute_command() ile çalıştırır; özel komutlar
+ *   (clear, help, version vb.) Model'in yerleşik komut tablosunda bulunur,
+ *   bkz. register_builtins()
  * 
  * @param tab_index İşlenecek sekme indeksi
  * @param input Kullanıcı girişi (komut veya mesaj)
@@ -43,49 +48,7 @@ void on_user_input(int tab_index, const char *input) {
     // Komut geçmişini güncelle
     model_add_to_history(input);
     
-    // Özel komutları işle
-    if (strcmp(input, "clear") == 0) {
-        view_clear_terminal(tab_index);
-        return;
-    }
-    
-    if (strcmp(input, "help") == 0) {
-        show_help(tab_index);
-        return;
-    }
-    
-    if (strcmp(input, "version") == 0) {
-        view_append_output_colored(tab_index, "Modüler Terminal v1.0\n", "lightgreen");
-        return;
-    }
-    
-    if (strcmp(input, "date") == 0) {
-        show_date(tab_index);
-        return;
-    }
-    
-    if (strcmp(input, "whoami") == 0) {
-        show_whoami(tab_index);
-        return;
-    }
-    
-    if (strcmp(input, "uptime") == 0) {
-        show_uptime(tab_index);
-        return;
-    }
-    
-    if (strcmp(input, "joke") == 0) {
-        show_joke(tab_index);
-        return;
-    }
-    
-    // cd komutu
-    if (g_str_has_prefix(input, "cd ")) {
-        handle_cd_command(tab_index, input + 3);
-        return;
-    }
-    
-    // Mesajlar ve normal komutlar
+    // Mesajlar ve komutlar
     if (strncmp(input, "@msg ", 5) == 0) {
         const char *msg = input + 5;
         model_send_message(tab_index, msg);
@@ -95,6 +58,15 @@ void on_user_input(int tab_index, const char *input) {
     }
 }
 
+/**
+ * @brief Ekranı temizleyen "clear" komutu
+ * 
+ * @param tab_index Temizlenecek sekme indeksi
+ */
+static void clear_terminal(int tab_index, const char *args, int background) {
+    view_clear_terminal(tab_index);
+}
+
 /**
  * @brief Yardım komutunu işleyen yardımcı fonksiyon
  * 
@@ -102,7 +74,7 @@ void on_user_input(int tab_index, const char *input) {
  * 
  * @param tab_index Görüntülenecek sekme indeksi
  */
-static void show_help(int tab_index) {
+static void show_help(int tab_index, const char *args, int background) {
     view_append_output_colored(tab_index, "Desteklenen komutlar:\n", "lightblue");
     view_append_output_colored(tab_index,
         " - clear: ekranı temizler\n"
@@ -112,16 +84,42 @@ static void show_help(int tab_index) {
         " - whoami: kullanıcı adınızı gösterir\n"
         " - uptime: sistem çalışma süresini gösterir\n"
         " - joke: rastgele bir şaka yapar\n"
+        " - meminfo: sekmelerin çıktı tamponlarının boyutunu ve etiket sayısını gösterir\n"
+        " - scrollback [satır] [-b bayt]: sekmenin geri kaydırma sınırını gösterir / değiştirir\n"
+        " - outview [text|list]: yeni sekmelerin çıktı alanını seçer (list: milyonlarca satır için)\n"
+        " - komut &: komutu arka planda çalıştırır\n"
+        " - a ; b, a && b, a || b: komutları sırayla / koşullu çalıştırır ($? son çıkış kodu)\n"
+        " - $(komut), `komut`: komutun çıktısını argüman olarak yerine koyar\n"
+        " - jobs, fg [%n], bg [%n]: işleri listeler, ön/arka plana alır\n"
+        " - kill [-SİNYAL] %n|pid: işe sinyal gönderir\n"
+        " - wait [%n]: arka plan işlerinin bitmesini bekler\n"
+        " - parallel [-j N] komut {} ::: girdiler: komutu girdiler için paralel çalıştırır\n"
+        " - cd [dizin|-], pushd [dizin], popd, dirs: sekmenin çalışma dizinini değiştirir\n"
+        " - capture [open|save|search|rm N]: sekmeye sığmayan büyük çıktıları yönetir\n"
+        " - time komut: komutun süresini, CPU ve bellek kullanımını gösterir\n"
+        " - limit [-t süre] [-c cpu] [-m bellek] [-n dosya] [komut]: süre ve kaynak sınırı koyar\n"
+        " - echo, printf, pwd, env, true, false: yeni süreç başlatmadan çalışır\n"
+        " - AD=değer, export [AD[=değer]], unset AD: sekmenin değişkenleri ($AD, ${AD})\n"
+        " - *, ?, [...], **: joker karakterler eşleşen dosya adlarına genişletilir\n"
         " - @msg <mesaj>: mesaj gönderir\n"
         , "lightblue");
 }
 
+/**
+ * @brief Sürüm bilgisini gösteren fonksiyon
+ * 
+ * @param tab_index Görüntülenecek sekme indeksi
+ */
+static void show_version(int tab_index, const char *args, int background) {
+    view_append_output_colored(tab_index, "Modüler Terminal v1.0\n", "lightgreen");
+}
+
 /**
  * @brief Sistem tarih ve zamanını gösteren fonksiyon
  * 
  * @param tab_index Görüntülenecek sekme indeksi
  */
-static void show_date(int tab_index) {
+static void show_date(int tab_index, const char *args, int background) {
     time_t t = time(NULL);
     char *time_str = ctime(&t);
     view_append_output_colored(tab_index, time_str, "lightgreen");
@@ -132,7 +130,7 @@ static void show_date(int tab_index) {
  * 
  * @param tab_index Görüntülenecek sekme indeksi
  */
-static void show_whoami(int tab_index) {
+static void show_whoami(int tab_index, const char *args, int background) {
     const char *user = g_get_user_name();
     view_append_output_colored(tab_index, user, "lightblue");
     view_append_output_colored(tab_index, "\n", "lightblue");
@@ -146,7 +144,7 @@ static void show_whoami(int tab_index) {
  * 
  * @param tab_index Görüntülenecek sekme indeksi
  */
-static void show_uptime(int tab_index) {
+static void show_uptime(int tab_index, const char *args, int background) {
     FILE *fp = fopen("/proc/uptime", "r");
     if (fp) {
         double up;
@@ -168,7 +166,7 @@ static void show_uptime(int tab_index) {
  * 
  * @param tab_index Görüntülenecek sekme indeksi
  */
-static void show_joke(int tab_index) {
+static void show_joke(int tab_index, const char *args, int background) {
     // Şaka koleksiyonu
     const char *jokes[] = {
         "Why do programmers hate nature?\nIt has too many bugs.\n",
@@ -192,17 +190,130 @@ static void show_joke(int tab_index) {
 }
 
 /**
- * @brief Dizin değiştirme (cd) komutunu işleyen fonksiyon
+ * @brief Sekmelerin çıktı tamponlarını özetleyen "meminfo" komutu
+ * 
+ * Her açık sekme için çıktı alanının türünü, tampondaki satır/bayt sayısını, etiket tablosundaki
+ * etiket sayısını ve çizim hızını gösterir. Etiketler stil başına bir kez
+ * oluşturulduğundan etiket sayısı çıktı miktarıyla değil, kullanılan renk/biçim
+ * sayısıyla artar. Çizim hızı, kare başına topluca yapılan aktarımların
+ * (insert + kaydırma) toplam süresine göre MB/s olarak hesaplanır.
  * 
  * @param tab_index Görüntülenecek sekme indeksi
- * @param path Geçilecek dizin yolu
  */
-static void handle_cd_command(int tab_index, const char *path) {
-    if (chdir(path) == 0) {
-        view_append_output_colored(tab_index, "Dizin değiştirildi\n", "lightgreen");
-    } else {
-        view_append_output_colored(tab_index, "Hedef dizine geçilemedi\n", "red");
+static void show_meminfo(int tab_index, const char *args, int background) {
+    char line[256];
+    for (int i = 0; i < MAX_TABS; i++) {
+        int max_lines, lines;
+        guint64 max_bytes, stored, trims;
+        if (!view_get_scrollback(i, &max_lines, &max_bytes, &lines, &stored, &trims)) continue;
+        snprintf(line, sizeof(line), "Terminal %d (%s): %d satır, %.2f MB, %d etiket\n", i + 1,
+                 view_tab_is_list(i) ? "liste" : "metin", lines, stored / 1048576.0, view_get_tag_count(i));
+        view_append_output_colored(tab_index, line, "lightblue");
+
+        guint64 frames, bytes;
+        gint64 usec;
+        if (view_get_render_stats(i, &frames, &bytes, &usec) && frames > 0) {
+            snprintf(line, sizeof(line), "  çizim: %llu kare, %.2f MB, %.1f ms (%.1f MB/s)\n",
+                     (unsigned long long)frames, bytes / 1048576.0, usec / 1000.0,
+                     usec > 0 ? (bytes / 1048576.0) / (usec / 1e6) : 0.0);
+            view_append_output_colored(tab_index, line, "lightblue");
+        }
+    }
+}
+
+/**
+ * @brief Sekmenin geri kaydırma sınırını gösteren / değiştiren "scrollback" komutu
+ * 
+ * "scrollback 5000" satır, "scrollback -b 64M" bayt sınırını ayarlar (K/M/G
+ * ekleri 1024 tabanlıdır), 0 sınırı kaldırır. Argümansız kullanım sınırı ve
+ * tamponun doluluğunu gösterir. Sınır aşıldığında tampon baştan kırpılır.
+ * 
+ * @param tab_index Sınırı değişecek sekme
+ * @param args Komut adından sonraki kısım
+ */
+static void set_scrollback(int tab_index, const char *args, int background) {
+    int lines = -1;
+    guint64 bytes = G_MAXUINT64;
+    char *copy = g_strdup(args ? args : "");
+    char *saveptr = NULL;
+    int ok = 1;
+    for (char *tok = strtok_r(copy, " \t", &saveptr); tok && ok; tok = strtok_r(NULL, " \t", &saveptr)) {
+        int is_bytes = strcmp(tok, "-b") == 0;
+        if (is_bytes) tok = strtok_r(NULL, " \t", &saveptr);
+        char *end = NULL;
+        unsigned long long value = tok ? strtoull(tok, &end, 10) : 0;
+        if (!tok || end == tok || *tok == '-') {
+            ok = 0;
+        } else if (is_bytes) {
+            const char *units = "KMG";
+            const char *unit = *end ? strchr(units, g_ascii_toupper(*end)) : NULL;
+            if (unit) {
+                value <<= 10 * (unit - units + 1);
+                end++;
+            }
+            bytes = value;
+            ok = *end == '\0';
+        } else {
+            lines = value > G_MAXINT ? G_MAXINT : (int)value;
+            ok = *end == '\0';
+        }
+    }
+    g_free(copy);
+    if (!ok) {
+        view_append_output_colored(tab_index, "Kullanım: scrollback [satır] [-b bayt]  (0 = sınırsız)\n", "red");
+        return;
+    }
+    view_set_scrollback(tab_index, lines, bytes);
+
+    int max_lines, cur_lines;
+    guint64 max_bytes, cur_bytes, trims;
+    if (!view_get_scrollback(tab_index, &max_lines, &max_bytes, &cur_lines, &cur_bytes, &trims)) return;
+    char limit_lines[32], limit_bytes[32], line[256];
+    if (max_lines) snprintf(limit_lines, sizeof(limit_lines), "%d satır", max_lines);
+    else snprintf(limit_lines, sizeof(limit_lines), "sınırsız satır");
+    if (max_bytes) snprintf(limit_bytes, sizeof(limit_bytes), "%.1f MB", max_bytes / 1048576.0);
+    else snprintf(limit_bytes, sizeof(limit_bytes), "sınırsız bayt");
+    snprintf(line, sizeof(line), "Geri kaydırma: en fazla %s, %s; tamponda %d satır, %.1f MB (%llu kez kırpıldı)\n",
+             limit_lines, limit_bytes, cur_lines, cur_bytes / 1048576.0, (unsigned long long)trims);
+    view_append_output_colored(tab_index, line, "lightblue");
+}
+
+/**
+ * @brief Yeni sekmelerin çıktı alanını seçen "outview" komutu
+ * 
+ * "outview list" sonraki sekmeleri sanal liste görünümüyle (GtkListView) açar:
+ * yalnızca görünen satırlar çizildiğinden çok büyük çıktılarda kaydırma hızlı
+ * kalır. "outview text" varsayılan GtkTextView'a döner. Açık sekmeler değişmez.
+ * 
+ * @param tab_index Görüntülenecek sekme indeksi
+ * @param args "text", "list" veya boş (göster)
+ */
+static void set_output_view(int tab_index, const char *args, int background) {
+    if (args && strcmp(args, "list") == 0) {
+        view_set_list_output(TRUE);
+    } else if (args && strcmp(args, "text") == 0) {
+        view_set_list_output(FALSE);
+    } else if (args && *args) {
+        view_append_output_colored(tab_index, "Kullanım: outview [text|list]\n", "red");
+        return;
     }
+    char line[160];
+    snprintf(line, sizeof(line), "Yeni sekmeler: %s; bu sekme: %s\n",
+             view_get_list_output() ? "list" : "text", view_tab_is_list(tab_index) ? "list" : "text");
+    view_append_output_colored(tab_index, line, "lightblue");
+}
+
+/**
+ * @brief Sekmenin çalışma dizini değiştiğinde Model tarafından çağrılır
+ * 
+ * Dizin değişikliği sekme başlığına yansıtılır. cd/pushd/popd Model'de
+ * sekme başına işlenir; sürecin kendi çalışma dizini değişmez.
+ * 
+ * @param tab_index Dizini değişen sekme
+ * @param path Yeni dizinin mutlak yolu
+ */
+static void handle_cwd_changed(int tab_index, const char *path) {
+    view_set_tab_title(tab_index, path);
 }
 
 /**
@@ -238,7 +349,7 @@ static gboolean check_messages(gpointer user_data) {
     if (msg && msg[0] != '\0') {
         for (int i = 0; i < MAX_TABS; i++) {
             // Var olan sekmelere mesajı gönder
-            if (i < MAX_TABS && GTK_IS_TEXT_VIEW(view_get_output_widget(i))) {
+            if (i < MAX_TABS && view_get_output_widget(i)) {
                 view_append_output_colored(i, msg, "deepskyblue");
                 view_append_output(i, "\n");
             }
@@ -248,12 +359,37 @@ static gboolean check_messages(gpointer user_data) {
     return G_SOURCE_CONTINUE;
 }
 
+/**
+ * @brief Controller'ın View'a yazan komutlarını Model'in yerleşik komut tablosuna kaydeder
+ * 
+ * Komutlar yalnızca argümansız yazıldığında yerleşiktir ("date +%s" dış date
+ * programına gider) ve sekme meşgulken de hemen çalışır.
+ */
+static void register_builtins(void) {
+    static const struct { const char *name; BuiltinFunc func; } builtins[] = {
+        { "clear", clear_terminal },
+        { "help", show_help },
+        { "version", show_version },
+        { "date", show_date },
+        { "whoami", show_whoami },
+        { "uptime", show_uptime },
+        { "joke", show_joke },
+        { "meminfo", show_meminfo },
+    };
+    for (size_t i = 0; i < sizeof(builtins) / sizeof(builtins[0]); i++) {
+        model_register_builtin(builtins[i].name, builtins[i].func, BUILTIN_IMMEDIATE | BUILTIN_NO_ARGS);
+    }
+    model_register_builtin("scrollback", set_scrollback, BUILTIN_IMMEDIATE);
+    model_register_builtin("outview", set_output_view, BUILTIN_IMMEDIATE);
+}
+
 /**
  * @brief Controller modülünü başlatan ana fonksiyon
  * 
  * MVC mimarisini başlatır:
  * 1. Model katmanını başlatır
- * 2. Komut çıktıları için callback fonksiyonu ayarlar
+ * 2. Komut çıktıları ve dizin değişiklikleri için callback fonksiyonları ayarlar,
+ *    Controller komutlarını yerleşik komut olarak kaydeder
  * 3. View katmanını başlatır
  * 4. Kullanıcı girişleri için callback fonksiyonu ayarlar
  * 5. Mesaj kontrolü için zamanlayıcı ekler
@@ -265,6 +401,8 @@ static gboolean check_messages(gpointer user_data) {
 void controller_start(int argc, char **argv) {
     model_init();  // Model katmanını başlat
     model_set_output_callback(handle_command_output);  // Çıktı callback'ini ayarla
+    model_set_cwd_callback(handle_cwd_changed);  // Sekme başlıkları dizini göstersin
+    register_builtins();  // clear, help, date ...
     
     view_init(argc, argv);  // View katmanını başlat
     view_set_input_callback(on_user_input);  // Giriş callback'ini ayarla
@@ -2,5 +2,6 @@
 #define CONTROLLER_H
 
 void controller_start(int argc, char **argv);
+void on_user_input(int tab_index, const char *input);
 
 #endif
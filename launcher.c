@@ -0,0 +1,1074 @@
+/**
+ * @file launcher.c
+ * @brief Komutlar için süreç başlatıcı
+ *
+ * Komutlar, GTK başlatılmadan önce main() içinde fork edilen küçük bir yardımcı
+ * (zygote) süreç tarafından başlatılır. Yardımcının bellek izi küçük kaldığı için
+ * fork maliyeti GUI sürecinin ne kadar büyüdüğünden bağımsızdır ve çocuklar GUI'nin
+ * durumunu (GTK/GDK/GL eşlemeleri, iş parçacıkları) miras almaz.
+ *
+ * İletişim iki SOCK_SEQPACKET soket üzerinden yapılır:
+ * - ctl: GUI istek gönderir (argv + SCM_RIGHTS ile stdin/stdout/stderr ve
+ *        çalışma dizini fd'leri),
+ *        yardımcı PID, hata kodu ve başlatma süresiyle cevap verir. Ortamlar
+ *        (envp) ayrı, cevapsız isteklerle yardımcının yuvalarına yüklenir ve
+ *        başlatma istekleri yalnızca yuva numarasını taşır.
+ * - evt: yardımcı, SIGCHLD'yi signalfd ile yakalayıp wait4 ile topladığı her
+ *        çocuk için PID, çıkış durumu ve kaynak kullanımını gönderir; GUI bu
+ *        soketi ana döngüde dinler.
+ *
+ * Yardımcıya ulaşılamazsa komutlar doğrudan GUI'den posix_spawn ile başlatılır
+ * (glibc bunu clone(CLONE_VM|CLONE_VFORK) ile uygular, sayfa tabloları kopyalanmaz).
+ * Bu çocuklar için pidfd_open ile alınan fd ana döngüde dinlenir; süreç çıktığı
+ * anda fd okunabilir olur ve yalnızca o süreç toplanır.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <spawn.h>
+#include <signal.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/signalfd.h>
+#include <sys/stat.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <glib-unix.h>
+#include "launcher.h"
+
+extern char **environ;
+
+#define HELPER_MSG_MAX 65536  // Tek bir isteğin en büyük boyutu (argv dahil, aşan istekler posix_spawn ile)
+#define HELPER_MAX_ARGS 4096  // Yardımcının kabul ettiği en fazla argüman
+#define HELPER_MAX_REDIRECTS 16 // Yardımcının kabul ettiği en fazla yönlendirme
+#define HELPER_MAX_LIMITS 8   // Yardımcının kabul ettiği en fazla kaynak sınırı
+#define HELPER_FDS 4          // İstekle gönderilebilen fd'ler: stdin, stdout, stderr, cwd
+#define HELPER_ENV_SLOTS 16   // Yardımcıda saklanan ortam sayısı (en az kullanılan değiştirilir)
+
+// HelperRequest.kind
+#define HELPER_REQ_SPAWN 0    // Komut başlat, HelperReply ile cevap ver
+#define HELPER_REQ_ENV 1      // env_slot yuvasına ortam yükle (argc dize), cevap yok
+
+// Yardımcıya gönderilen isteğin başlığı; ardından (has_path ise) NUL ile biten
+// çalıştırılacak yol, NUL ayrımlı argv, nredirects adet (HelperRedirect + yol) ve
+// nlimits adet LaunchLimit (işaretçi içermediği için olduğu gibi) gelir
+typedef struct {
+    uint32_t kind;            // HELPER_REQ_SPAWN veya HELPER_REQ_ENV
+    int32_t env_slot;         // Çocuğun ortamı olacak yuva (-1 = yardımcının environ'u)
+    uint32_t has_path;        // 1 ise execv ile doğrudan bu yol çalıştırılır
+    uint32_t argc;            // Argüman sayısı
+    uint32_t fd_mask;         // Gönderilen fd'ler: bit0=stdin, bit1=stdout, bit2=stderr, bit3=cwd
+    uint32_t payload_len;     // Başlıktan sonraki bayt sayısı
+    int32_t pgid;             // LaunchSpec.pgid ile aynı anlamda
+    uint32_t nredirects;      // Yönlendirme sayısı
+    uint32_t nlimits;         // Kaynak sınırı sayısı
+} HelperRequest;
+
+// İstek içindeki bir yönlendirme (LaunchRedirect'in kablo biçimi)
+typedef struct {
+    int32_t fd;
+    int32_t flags;
+    int32_t dup_from;
+    uint32_t has_path;        // 1 ise ardından NUL ile biten yol gelir
+} HelperRedirect;
+
+// Yardımcının isteğe cevabı
+typedef struct {
+    int32_t pid;              // Başlatılan süreç (-1 = hata)
+    int32_t error;            // Hata durumunda errno
+    int32_t redirect;         // Hataya yol açan yönlendirme (-1 = komutun kendisi)
+    uint64_t spawn_ns;        // fork'tan başarılı exec'e kadar geçen süre
+} HelperReply;
+
+// Çocuk sürecin exec'ten önce bildirdiği hata
+typedef struct {
+    int32_t error;
+    int32_t redirect;         // Yönlendirme indeksi, -1 = komutun kendisi veya CHILD_DETACHED
+} ChildError;
+
+// ChildError.redirect: çocuk bloklayabilecek bir açılışa geçti; başlatma başarılı
+// sayılır, sonraki hataları çocuk kendi stderr'ine yazar ve çıkış koduyla bildirir
+#define CHILD_DETACHED -2
+
+// Yardımcının bir çocuğu topladığında gönderdiği olay
+typedef struct {
+    int32_t pid;              // Toplanan süreç
+    int32_t status;           // waitpid durumu
+    LaunchUsage usage;        // wait4'ün döndürdüğü kaynak kullanımı
+} HelperEvent;
+
+// Sonlanması beklenen bir süreç için kayıt
+typedef struct {
+    LaunchExitCallback callback;
+    void *user_data;
+    pid_t pid;                // Doğrudan başlatılan süreç
+    int pidfd;                // Doğrudan başlatılan süreç için pidfd (-1 = yok)
+} PendingExit;
+
+static int helper_ctl = -1;       // İstek/cevap soketi (GUI ucu)
+static int helper_evt = -1;       // Olay soketi (GUI ucu)
+static pid_t helper_pid = -1;     // Yardımcı sürecin PID'i
+static guint helper_watch = 0;    // Olay soketi için ana döngü kaynağı
+static GHashTable *pending = NULL; // PID -> PendingExit (yardımcının çocukları)
+static LaunchStats stats;
+
+// Yardımcının ortam yuvalarında hangi envp'lerin bulunduğu (GUI tarafı)
+static uint64_t env_slot_id[HELPER_ENV_SLOTS];   // Yuvadaki env_id (0 = boş)
+static uint64_t env_slot_used[HELPER_ENV_SLOTS]; // Son kullanım sırası
+static uint64_t env_slot_clock = 0;
+
+// Yardımcı tarafı: yuvalara yüklenen ortamlar
+static char *helper_env_block[HELPER_ENV_SLOTS]; // NUL ayrımlı dizeler
+static char **helper_envp[HELPER_ENV_SLOTS];     // Bloğu gösteren NULL ile biten dizi
+
+/**
+ * @brief Monoton saati nanosaniye cinsinden döndürür
+ */
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+/**
+ * @brief wait4'ün döndürdüğü rusage'ı LaunchUsage'a çevirir
+ */
+static void fill_usage(LaunchUsage *usage, const struct rusage *ru) {
+    usage->exit_ns = now_ns();
+    usage->user_us = (uint64_t)ru->ru_utime.tv_sec * 1000000 + ru->ru_utime.tv_usec;
+    usage->sys_us = (uint64_t)ru->ru_stime.tv_sec * 1000000 + ru->ru_stime.tv_usec;
+    usage->max_rss_kb = ru->ru_maxrss;
+    usage->major_faults = ru->ru_majflt;
+}
+
+/**
+ * @brief Başarılı bir başlatmanın süresini istatistiklere ekler
+ *
+ * @param spawn_ns Başlatma süresi
+ * @param rtt_ns GUI tarafında ölçülen toplam süre
+ * @param helper Yardımcı üzerinden mi yapıldı
+ */
+static void record_spawn(uint64_t spawn_ns, uint64_t rtt_ns, int helper) {
+    if (stats.count == 0 || spawn_ns < stats.min_ns) stats.min_ns = spawn_ns;
+    if (spawn_ns > stats.max_ns) stats.max_ns = spawn_ns;
+    stats.last_ns = spawn_ns;
+    stats.total_ns += spawn_ns;
+    stats.total_rtt_ns += rtt_ns;
+    stats.count++;
+    if (helper) stats.via_helper++;
+}
+
+// ------------------- Yardımcı (zygote) süreç -------------------
+
+/**
+ * @brief CHILD_DETACHED'dan sonraki başlatma hatasını çocuğun stderr'ine yazar ve çıkar
+ *
+ * İleti ve çıkış kodu Model'in eşzamanlı hatalar için yazdıklarıyla aynıdır
+ * (yönlendirme 1, bulunamayan komut 127, diğerleri 126). Yardımcı tek iş
+ * parçacıklı olduğundan çocukta snprintf/strerror güvenlidir.
+ */
+static void child_report_late(const ChildError *ce, const char *command, const LaunchRedirect *redirects) {
+    char msg[512];
+    int status;
+    if (ce->redirect >= 0) {
+        snprintf(msg, sizeof(msg), "%s: %s\n", redirects[ce->redirect].path, strerror(ce->error));
+        status = 1;
+    } else if (ce->error == ENOENT) {
+        snprintf(msg, sizeof(msg), "Komut bulunamadı: %s\n", command);
+        status = 127;
+    } else {
+        snprintf(msg, sizeof(msg), "[Hata: Süreç oluşturulamadı: %s: %s]\n", command, strerror(ce->error));
+        status = 126;
+    }
+    ssize_t unused = write(STDERR_FILENO, msg, strlen(msg));
+    (void)unused;
+    _exit(status);
+}
+
+/**
+ * @brief Yardımcı sürecin çocuğunda çalışır: fd'leri bağlar ve komutu çalıştırır
+ *
+ * Yalnızca async-signal-safe çağrılar kullanılır. Çalışma dizini fds[3]
+ * verilmişse yönlendirmelerden önce uygulanır, böylece göreli yollar sekmenin
+ * dizinine göre çözülür. Kaynak sınırları en son, exec'ten hemen önce konur ki
+ * düşük bir RLIMIT_NOFILE yönlendirmeleri engellemesin. exec, bir yönlendirme
+ * veya bir sınır başarısız olursa hata err_fd'ye yazılır.
+ *
+ * FIFO veya aygıt açmak karşı taraf gelene kadar bloklayabilir ("cat < fifo").
+ * Yardımcı err_fd'yi okurken, GUI de cevabı beklerken donmasın diye böyle bir
+ * açılıştan önce err_fd'ye CHILD_DETACHED yazılır ve kapatılır; komut normal bir
+ * iş gibi çalışır (Ctrl+C ile kesilebilir), sonraki hatalar child_report_late ile
+ * bildirilir.
+ */
+static void helper_exec_child(const char *path, char **argv, char **envp, const int fds[HELPER_FDS],
+                              pid_t pgid, const LaunchRedirect *redirects, int nredirects,
+                              const LaunchLimit *limits, int nlimits, int err_fd) {
+    ChildError ce = { .error = 0, .redirect = -1 };
+    sigset_t empty;
+    sigemptyset(&empty);
+    sigprocmask(SIG_SETMASK, &empty, NULL); // signalfd için bloklanan SIGCHLD'yi aç
+
+    // Katılınacak grubun tüm üyeleri bitip toplandıysa grup artık yoktur (EPERM);
+    // bu durumda yeni bir grup kurulur (canlı üye kalmadığı için iş yine tek gruptadır)
+    if (pgid >= 0 && setpgid(0, pgid) == -1) {
+        if (pgid == 0 || errno != EPERM || setpgid(0, 0) == -1) goto fail;
+    }
+    if (fds[3] != -1 && fchdir(fds[3]) == -1) goto fail;
+    for (int i = 0; i < 3; i++) {
+        if (fds[i] != -1 && dup2(fds[i], i) == -1) goto fail;
+    }
+    for (int i = 0; i < nredirects; i++) {
+        const LaunchRedirect *r = &redirects[i];
+        ce.redirect = i;
+        if (r->path) {
+            struct stat st;
+            if (err_fd != -1 && stat(r->path, &st) == 0 && !S_ISREG(st.st_mode) && !S_ISDIR(st.st_mode)) {
+                ChildError detach = { .error = 0, .redirect = CHILD_DETACHED };
+                ssize_t unused = write(err_fd, &detach, sizeof(detach));
+                (void)unused;
+                close(err_fd);
+                err_fd = -1;
+            }
+            int fd = open(r->path, r->flags, 0666);
+            if (fd == -1) goto fail;
+            if (fd != r->fd) {
+                if (dup2(fd, r->fd) == -1) goto fail;
+                close(fd);
+            }
+        } else if (dup2(r->dup_from, r->fd) == -1) {
+            goto fail;
+        }
+    }
+    ce.redirect = -1;
+    for (int i = 0; i < nlimits; i++) {
+        struct rlimit rl = { .rlim_cur = limits[i].soft, .rlim_max = limits[i].hard };
+        if (setrlimit(limits[i].resource, &rl) == -1) goto fail;
+    }
+    if (envp) environ = envp; // execv/execvp çocuğa environ'u verir (execvp PATH'i de oradan okur)
+    if (path) {
+        execv(path, argv); // Yol GUI'nin PATH önbelleğinden geldi, arama yapılmaz
+    } else {
+        execvp(argv[0], argv);
+    }
+fail:
+    ce.error = errno;
+    if (err_fd == -1) child_report_late(&ce, argv[0], redirects);
+    ssize_t unused = write(err_fd, &ce, sizeof(ce));
+    (void)unused;
+    _exit(127);
+}
+
+/**
+ * @brief Bir ortamı (NUL ayrımlı count dize) yardımcının yuvasına yükler
+ *
+ * Yuvadaki eski ortam bırakılır. Bellek yetmezse yuva boş kalır ve o yuvayı
+ * kullanan başlatmalar ENOMEM ile başarısız olur.
+ */
+static void helper_load_env(int slot, const char *data, size_t len, uint32_t count) {
+    free(helper_env_block[slot]);
+    free(helper_envp[slot]);
+    helper_env_block[slot] = NULL;
+    helper_envp[slot] = NULL;
+
+    char *block = malloc(len + 1);
+    char **envp = malloc((count + 1) * sizeof(char *));
+    if (!block || !envp) {
+        free(block);
+        free(envp);
+        return;
+    }
+    memcpy(block, data, len);
+    block[len] = '\0';
+    char *p = block;
+    uint32_t i = 0;
+    for (; i < count && p < block + len; i++) {
+        envp[i] = p;
+        p += strlen(p) + 1;
+    }
+    envp[i] = NULL;
+    helper_env_block[slot] = block;
+    helper_envp[slot] = envp;
+}
+
+/**
+ * @brief Tek bir başlatma isteğini işler ve cevabı gönderir
+ *
+ * @param ctl İstek soketi
+ * @param msg Alınan mesaj
+ * @param len Mesaj uzunluğu
+ * @param fds Alınan stdin/stdout/stderr/cwd (-1 = yok)
+ */
+static void helper_handle_request(int ctl, char *msg, size_t len, const int fds[HELPER_FDS]) {
+    static char *argv[HELPER_MAX_ARGS + 1];
+    static LaunchRedirect redirects[HELPER_MAX_REDIRECTS];
+    static LaunchLimit limits[HELPER_MAX_LIMITS];
+    HelperReply reply = { .pid = -1, .error = EINVAL, .redirect = -1, .spawn_ns = 0 };
+    HelperRequest *req = (HelperRequest *)msg;
+
+    if (len >= sizeof(*req) && req->kind == HELPER_REQ_ENV) {
+        if (req->env_slot >= 0 && req->env_slot < HELPER_ENV_SLOTS && req->payload_len == len - sizeof(*req)) {
+            helper_load_env(req->env_slot, msg + sizeof(*req), req->payload_len, req->argc);
+        }
+        for (int i = 0; i < HELPER_FDS; i++) {
+            if (fds[i] != -1) close(fds[i]);
+        }
+        return; // Cevap yok: sıradaki başlatma isteği yuvayı kullanır
+    }
+
+    if (len < sizeof(*req) || req->payload_len != len - sizeof(*req) ||
+        req->kind != HELPER_REQ_SPAWN || req->env_slot >= HELPER_ENV_SLOTS ||
+        req->argc == 0 || req->argc > HELPER_MAX_ARGS ||
+        req->nredirects > HELPER_MAX_REDIRECTS || req->nlimits > HELPER_MAX_LIMITS) {
+        goto reply;
+    }
+
+    char *p = msg + sizeof(*req);
+    char *end = p + req->payload_len;
+    const char *path = NULL;
+    if (req->has_path) {
+        char *nul = memchr(p, '\0', end - p);
+        if (!nul) goto reply;
+        path = p;
+        p = nul + 1;
+    }
+
+    // NUL ayrımlı argv'yi yeniden kur
+    for (uint32_t i = 0; i < req->argc; i++) {
+        char *nul = memchr(p, '\0', end - p);
+        if (!nul) goto reply;
+        argv[i] = p;
+        p = nul + 1;
+    }
+    argv[req->argc] = NULL;
+
+    // Yönlendirmeleri çöz
+    for (uint32_t i = 0; i < req->nredirects; i++) {
+        HelperRedirect hr;
+        if ((size_t)(end - p) < sizeof(hr)) goto reply;
+        memcpy(&hr, p, sizeof(hr));
+        p += sizeof(hr);
+        redirects[i].fd = hr.fd;
+        redirects[i].flags = hr.flags;
+        redirects[i].dup_from = hr.dup_from;
+        redirects[i].path = NULL;
+        if (hr.has_path) {
+            char *nul = memchr(p, '\0', end - p);
+            if (!nul) goto reply;
+            redirects[i].path = p;
+            p = nul + 1;
+        }
+    }
+    if ((size_t)(end - p) < req->nlimits * sizeof(LaunchLimit)) goto reply;
+    memcpy(limits, p, req->nlimits * sizeof(LaunchLimit));
+
+    char **envp = NULL;
+    if (req->env_slot >= 0) {
+        envp = helper_envp[req->env_slot];
+        if (!envp) {
+            reply.error = ENOMEM;
+            goto reply;
+        }
+    }
+
+    uint64_t start = now_ns();
+    int errpipe[2];
+    if (pipe2(errpipe, O_CLOEXEC) == -1) {
+        reply.error = errno;
+        goto reply;
+    }
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(errpipe[0]);
+        helper_exec_child(path, argv, envp, fds, req->pgid, redirects, req->nredirects,
+                          limits, req->nlimits, errpipe[1]);
+    }
+    close(errpipe[1]);
+    if (pid == -1) {
+        reply.error = errno;
+        close(errpipe[0]);
+        goto reply;
+    }
+
+    // exec başarılı olursa errpipe O_CLOEXEC sayesinde kapanır ve read 0 döner;
+    // FIFO/aygıt açmadan önce çocuk CHILD_DETACHED yazar, başlatma başarılı sayılır
+    ChildError ce;
+    ssize_t n;
+    do {
+        n = read(errpipe[0], &ce, sizeof(ce));
+    } while (n == -1 && errno == EINTR);
+    close(errpipe[0]);
+
+    if (n == sizeof(ce) && ce.redirect != CHILD_DETACHED) {
+        waitpid(pid, NULL, 0); // Başarısız çocuğu hemen topla, olay gönderme
+        reply.error = ce.error;
+        reply.redirect = ce.redirect;
+    } else {
+        reply.pid = pid;
+        reply.error = 0;
+        reply.spawn_ns = now_ns() - start;
+    }
+
+reply:
+    for (int i = 0; i < HELPER_FDS; i++) {
+        if (fds[i] != -1) close(fds[i]);
+    }
+    send(ctl, &reply, sizeof(reply), MSG_NOSIGNAL);
+}
+
+// Henüz gönderilemeyen çıkış olayları; GUI yoğunken yardımcı bloklanmasın diye
+// olay soketi bloklamasızdır ve fazlası burada bekletilir
+static HelperEvent *outbox = NULL;
+static size_t outbox_head = 0, outbox_len = 0, outbox_cap = 0;
+
+/**
+ * @brief Bekleyen çıkış olaylarını soket doldukça gönderir
+ *
+ * @param evt Olay soketi
+ */
+static void helper_flush_events(int evt) {
+    while (outbox_head < outbox_len) {
+        ssize_t n = send(evt, &outbox[outbox_head], sizeof(HelperEvent), MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (n == -1 && errno == EINTR) continue;
+        if (n == -1 && errno == EAGAIN) return; // POLLOUT ile tekrar denenecek
+        outbox_head++; // Gönderildi (veya GUI gitti, olay atlanır)
+    }
+    outbox_head = outbox_len = 0;
+}
+
+/**
+ * @brief Sonlanan tüm çocukları toplar ve GUI'ye bildirir
+ *
+ * @param evt Olay soketi
+ */
+static void helper_reap_children(int evt) {
+    int status;
+    struct rusage ru;
+    pid_t pid;
+    while ((pid = wait4(-1, &status, WNOHANG, &ru)) > 0) {
+        if (outbox_len == outbox_cap) {
+            size_t cap = outbox_cap ? outbox_cap * 2 : 64;
+            HelperEvent *grown = realloc(outbox, cap * sizeof(*grown));
+            if (!grown) continue; // Bellek yok: olay kaybolur, süreç yine de toplandı
+            outbox = grown;
+            outbox_cap = cap;
+        }
+        outbox[outbox_len].pid = pid;
+        outbox[outbox_len].status = status;
+        fill_usage(&outbox[outbox_len].usage, &ru);
+        outbox_len++;
+    }
+    helper_flush_events(evt);
+}
+
+/**
+ * @brief Yardımcı sürecin ana döngüsü; GUI soketi kapanınca çıkar
+ *
+ * @param ctl İstek soketi
+ * @param evt Olay soketi
+ */
+static void helper_main(int ctl, int evt) {
+    static char msg[HELPER_MSG_MAX];
+    char cmsg_buf[CMSG_SPACE(HELPER_FDS * sizeof(int))];
+
+    sigset_t chld;
+    sigemptyset(&chld);
+    sigaddset(&chld, SIGCHLD);
+    sigprocmask(SIG_BLOCK, &chld, NULL);
+    int sfd = signalfd(-1, &chld, SFD_CLOEXEC | SFD_NONBLOCK);
+    if (sfd == -1) _exit(1);
+
+    struct pollfd pfd[3] = {
+        { .fd = ctl, .events = POLLIN },
+        { .fd = sfd, .events = POLLIN },
+        { .fd = -1, .events = POLLOUT },
+    };
+
+    for (;;) {
+        pfd[2].fd = outbox_head < outbox_len ? evt : -1; // Yalnızca bekleyen olay varsa dinle
+        if (poll(pfd, 3, -1) == -1) {
+            if (errno == EINTR) continue;
+            _exit(1);
+        }
+
+        if (pfd[2].revents & (POLLOUT | POLLERR | POLLHUP)) {
+            helper_flush_events(evt);
+        }
+
+        if (pfd[1].revents & POLLIN) {
+            struct signalfd_siginfo si;
+            while (read(sfd, &si, sizeof(si)) == sizeof(si)) { }
+            helper_reap_children(evt);
+        }
+
+        if (pfd[0].revents & (POLLIN | POLLHUP | POLLERR)) {
+            struct iovec iov = { .iov_base = msg, .iov_len = sizeof(msg) };
+            struct msghdr mh = {
+                .msg_iov = &iov, .msg_iovlen = 1,
+                .msg_control = cmsg_buf, .msg_controllen = sizeof(cmsg_buf),
+            };
+            ssize_t n = recvmsg(ctl, &mh, MSG_CMSG_CLOEXEC);
+            if (n == -1 && errno == EINTR) continue;
+            if (n <= 0) _exit(0); // GUI kapandı
+
+            int received[HELPER_FDS] = { -1, -1, -1, -1 };
+            int nrecv = 0;
+            struct cmsghdr *cm = CMSG_FIRSTHDR(&mh);
+            if (cm && cm->cmsg_level == SOL_SOCKET && cm->cmsg_type == SCM_RIGHTS) {
+                nrecv = (cm->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+                if (nrecv > HELPER_FDS) nrecv = HELPER_FDS;
+                memcpy(received, CMSG_DATA(cm), nrecv * sizeof(int));
+            }
+
+            // fd_mask'e göre alınan fd'leri stdin/stdout/stderr/cwd'ye dağıt
+            int fds[HELPER_FDS] = { -1, -1, -1, -1 };
+            uint32_t mask = (size_t)n >= sizeof(HelperRequest) ? ((HelperRequest *)msg)->fd_mask : 0;
+            for (int i = 0, k = 0; i < HELPER_FDS; i++) {
+                if ((mask & (1u << i)) && k < nrecv) fds[i] = received[k++];
+            }
+            helper_handle_request(ctl, msg, n, fds);
+        }
+    }
+}
+
+/**
+ * @brief Yardımcı (zygote) süreci başlatır
+ *
+ * GTK başlatılmadan, süreç henüz küçükken main() içinden çağrılmalıdır.
+ * Başarısız olursa komutlar doğrudan posix_spawn ile başlatılır.
+ */
+void launcher_start_helper(void) {
+    int ctl[2], evt[2];
+    if (socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, ctl) == -1) {
+        perror("socketpair failed");
+        return;
+    }
+    if (socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, evt) == -1) {
+        perror("socketpair failed");
+        close(ctl[0]);
+        close(ctl[1]);
+        return;
+    }
+
+    pid_t pid = fork();
+    if (pid == -1) {
+        perror("fork failed");
+        close(ctl[0]); close(ctl[1]);
+        close(evt[0]); close(evt[1]);
+        return;
+    }
+    if (pid == 0) {
+        close(ctl[0]);
+        close(evt[0]);
+        helper_main(ctl[1], evt[1]);
+        _exit(0);
+    }
+
+    close(ctl[1]);
+    close(evt[1]);
+    helper_ctl = ctl[0];
+    helper_evt = evt[0];
+    helper_pid = pid;
+}
+
+// ------------------- GUI tarafı -------------------
+
+/**
+ * @brief Yardımcı bağlantısını kapatır; bekleyen süreçler "bilinmiyor" ile bildirilir
+ */
+static void helper_disconnect(void) {
+    if (helper_watch) {
+        g_source_remove(helper_watch);
+        helper_watch = 0;
+    }
+    if (helper_ctl != -1) close(helper_ctl);
+    if (helper_evt != -1) close(helper_evt);
+    helper_ctl = helper_evt = -1;
+
+    if (helper_pid > 0) {
+        waitpid(helper_pid, NULL, WNOHANG);
+        helper_pid = -1;
+    }
+
+    if (pending) {
+        GHashTable *orphans = pending;
+        pending = NULL;
+        GHashTableIter it;
+        gpointer key, value;
+        g_hash_table_iter_init(&it, orphans);
+        while (g_hash_table_iter_next(&it, &key, &value)) {
+            PendingExit *pe = value;
+            pe->callback(GPOINTER_TO_INT(key), -1, NULL, pe->user_data);
+        }
+        g_hash_table_destroy(orphans);
+    }
+}
+
+/**
+ * @brief Yardımcının olay soketinden gelen çıkış bildirimlerini işler
+ */
+static gboolean on_helper_event(gint fd, GIOCondition condition, gpointer user_data) {
+    HelperEvent ev;
+    ssize_t n;
+
+    while ((n = recv(fd, &ev, sizeof(ev), MSG_DONTWAIT)) == sizeof(ev)) {
+        PendingExit *pe = pending ? g_hash_table_lookup(pending, GINT_TO_POINTER(ev.pid)) : NULL;
+        if (!pe) continue;
+        g_hash_table_steal(pending, GINT_TO_POINTER(ev.pid));
+        pe->callback(ev.pid, ev.status, &ev.usage, pe->user_data);
+        g_free(pe);
+    }
+    if (n == -1 && (errno == EAGAIN || errno == EINTR)) return G_SOURCE_CONTINUE;
+
+    // EOF veya hata: yardımcı öldü
+    helper_watch = 0;
+    helper_disconnect();
+    return G_SOURCE_REMOVE;
+}
+
+/**
+ * @brief spec->envp'nin yüklü olduğu yardımcı yuvasını döndürür, yoksa yükler
+ *
+ * Yuvalar env_id ile tanınır; aynı ortamla yapılan başlatmalarda envp yeniden
+ * gönderilmez. Yer yoksa en uzun süredir kullanılmayan yuva değiştirilir.
+ *
+ * @return int Yuva, -1 (GUI'nin environ'u), -2 (yardımcı yanıt vermiyor) veya
+ *             ortam bir mesaja sığmıyorsa -3
+ */
+static int helper_env_slot(const LaunchSpec *spec) {
+    static char msg[HELPER_MSG_MAX];
+    if (!spec->envp) return -1;
+
+    int slot = 0;
+    for (int i = 0; i < HELPER_ENV_SLOTS; i++) {
+        if (spec->env_id && env_slot_id[i] == spec->env_id) {
+            env_slot_used[i] = ++env_slot_clock;
+            return i;
+        }
+        if (env_slot_used[i] < env_slot_used[slot]) slot = i;
+    }
+
+    HelperRequest *req = (HelperRequest *)msg;
+    memset(req, 0, sizeof(*req));
+    req->kind = HELPER_REQ_ENV;
+    req->env_slot = slot;
+    size_t off = sizeof(*req);
+    for (char *const *e = spec->envp; *e; e++) {
+        size_t len = strlen(*e) + 1;
+        if (off + len > sizeof(msg)) return -3;
+        memcpy(msg + off, *e, len);
+        off += len;
+        req->argc++;
+    }
+    req->payload_len = off - sizeof(*req);
+
+    ssize_t n;
+    do {
+        n = send(helper_ctl, msg, off, MSG_NOSIGNAL);
+    } while (n == -1 && errno == EINTR);
+    if (n == -1) return -2;
+    env_slot_id[slot] = spec->env_id; // 0 ise yuva bir sonraki aramada eşleşmez
+    env_slot_used[slot] = ++env_slot_clock;
+    return slot;
+}
+
+/**
+ * @brief Komutu yardımcı süreç üzerinden başlatır
+ *
+ * İstek (ortam, argv, yönlendirmeler, sınırlar) tek bir mesaja sığmalıdır.
+ * Sığmayan istekler, örneğin binlerce dosyaya genişleyen bir joker, yardımcıya
+ * gönderilmez; çekirdeğin ARG_MAX sınırına kadar yedek yoldan başlatılabilir.
+ *
+ * @return pid_t PID, hata için -1 (*error doldurulur), yardımcı kullanılamıyorsa -2,
+ *               istek yardımcıya gönderilemeyecek kadar büyükse -3
+ */
+static pid_t spawn_via_helper(const LaunchSpec *spec, LaunchError *error, uint64_t *spawn_ns) {
+    static char msg[HELPER_MSG_MAX];
+    HelperRequest *req = (HelperRequest *)msg;
+    size_t off = sizeof(*req);
+
+    int env_slot = helper_env_slot(spec);
+    if (env_slot < -1) return env_slot;
+    req->kind = HELPER_REQ_SPAWN;
+    req->env_slot = env_slot;
+
+    req->has_path = spec->path != NULL;
+    if (spec->path) {
+        size_t len = strlen(spec->path) + 1;
+        if (off + len > sizeof(msg)) return -3;
+        memcpy(msg + off, spec->path, len);
+        off += len;
+    }
+
+    req->argc = 0;
+    for (char *const *a = spec->argv; *a; a++) {
+        size_t len = strlen(*a) + 1;
+        if (off + len > sizeof(msg) || req->argc >= HELPER_MAX_ARGS) return -3;
+        memcpy(msg + off, *a, len);
+        off += len;
+        req->argc++;
+    }
+
+    if (spec->nredirects > HELPER_MAX_REDIRECTS) return -3;
+    req->nredirects = spec->nredirects;
+    for (int i = 0; i < spec->nredirects; i++) {
+        const LaunchRedirect *r = &spec->redirects[i];
+        HelperRedirect hr = { .fd = r->fd, .flags = r->flags, .dup_from = r->dup_from, .has_path = r->path != NULL };
+        size_t path_len = r->path ? strlen(r->path) + 1 : 0;
+        if (off + sizeof(hr) + path_len > sizeof(msg)) return -3;
+        memcpy(msg + off, &hr, sizeof(hr));
+        off += sizeof(hr);
+        memcpy(msg + off, r->path, path_len);
+        off += path_len;
+    }
+    size_t limits_len = spec->nlimits * sizeof(LaunchLimit);
+    if (spec->nlimits > HELPER_MAX_LIMITS || off + limits_len > sizeof(msg)) return -3;
+    req->nlimits = spec->nlimits;
+    if (limits_len) memcpy(msg + off, spec->limits, limits_len);
+    off += limits_len;
+    req->payload_len = off - sizeof(*req);
+    req->pgid = spec->pgid;
+
+    int fds[HELPER_FDS] = { spec->stdin_fd, spec->stdout_fd, spec->stderr_fd, spec->cwd_fd };
+    int to_send[HELPER_FDS];
+    int nfds = 0;
+    req->fd_mask = 0;
+    for (int i = 0; i < HELPER_FDS; i++) {
+        if (fds[i] != -1) {
+            req->fd_mask |= 1u << i;
+            to_send[nfds++] = fds[i];
+        }
+    }
+
+    char cmsg_buf[CMSG_SPACE(HELPER_FDS * sizeof(int))];
+    struct iovec iov = { .iov_base = msg, .iov_len = off };
+    struct msghdr mh = { .msg_iov = &iov, .msg_iovlen = 1 };
+    if (nfds > 0) {
+        memset(cmsg_buf, 0, sizeof(cmsg_buf));
+        mh.msg_control = cmsg_buf;
+        mh.msg_controllen = CMSG_SPACE(nfds * sizeof(int));
+        struct cmsghdr *cm = CMSG_FIRSTHDR(&mh);
+        cm->cmsg_level = SOL_SOCKET;
+        cm->cmsg_type = SCM_RIGHTS;
+        cm->cmsg_len = CMSG_LEN(nfds * sizeof(int));
+        memcpy(CMSG_DATA(cm), to_send, nfds * sizeof(int));
+    }
+
+    ssize_t n;
+    do {
+        n = sendmsg(helper_ctl, &mh, MSG_NOSIGNAL);
+    } while (n == -1 && errno == EINTR);
+    if (n == -1) return -2;
+
+    HelperReply reply;
+    do {
+        n = recv(helper_ctl, &reply, sizeof(reply), 0);
+    } while (n == -1 && errno == EINTR);
+    if (n != sizeof(reply)) return -2;
+
+    if (reply.pid == -1) {
+        error->code = reply.error;
+        error->redirect = reply.redirect;
+        return -1;
+    }
+    *spawn_ns = reply.spawn_ns;
+    return reply.pid;
+}
+
+/**
+ * @brief Belirtilen hedef fd'ye dup2 eylemi ekler
+ *
+ * @param actions Spawn dosya eylemleri
+ * @param fd Kaynak fd (-1 ise eylem eklenmez)
+ * @param target Hedef fd (0, 1 veya 2)
+ * @return int 0 veya hata kodu
+ */
+static int add_redirect(posix_spawn_file_actions_t *actions, int fd, int target) {
+    if (fd == -1) return 0;
+    return posix_spawn_file_actions_adddup2(actions, fd, target);
+}
+
+/**
+ * @brief Çocuğun çalışma dizinini değiştiren fchdir eylemini ekler
+ *
+ * @param actions Spawn dosya eylemleri
+ * @param fd Dizin fd'si (-1 ise eylem eklenmez)
+ * @return int 0 veya hata kodu (glibc 2.29'dan eskiyse ENOSYS)
+ */
+static int add_fchdir(posix_spawn_file_actions_t *actions, int fd) {
+    if (fd == -1) return 0;
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 29))
+    return posix_spawn_file_actions_addfchdir_np(actions, fd);
+#else
+    (void)actions;
+    return ENOSYS;
+#endif
+}
+
+/**
+ * @brief Yönlendirme hedefi FIFO veya aygıtsa onu GUI'de bloklamadan açar
+ *
+ * posix_spawn'ın addopen eylemi çocukta çalışır ve GUI exec'e kadar bekler;
+ * karşı tarafı olmayan bir FIFO bu yüzden ana döngüyü dondurur. Böyle hedefler
+ * O_NONBLOCK ile açılır, bayrak hemen kaldırılır ve fd çocuğa dup2 ile verilir.
+ * Bu yedek yolda okuyucusu olmayan FIFO'ya yazma ENXIO ile başarısız olur,
+ * yazıcısı olmayan FIFO'dan okuyan komut ise hemen EOF görür.
+ *
+ * @param dir Göreli yolların çözüleceği dizin
+ * @param r Yönlendirme (path NULL olmamalı)
+ * @return int Açılan fd, hedef normal dosya veya dizinse -1 (addopen kullanılır),
+ *             açılamazsa -2 (errno ayarlanır)
+ */
+static int open_special_target(int dir, const LaunchRedirect *r) {
+    struct stat st;
+    if (fstatat(dir, r->path, &st, 0) == -1 || S_ISREG(st.st_mode) || S_ISDIR(st.st_mode)) return -1;
+    int fd = openat(dir, r->path, r->flags | O_NONBLOCK | O_CLOEXEC, 0666);
+    if (fd == -1) return -2;
+    int fl = fcntl(fd, F_GETFL);
+    if (fl != -1) fcntl(fd, F_SETFL, fl & ~O_NONBLOCK);
+    return fd;
+}
+
+/**
+ * @brief Komutu doğrudan GUI sürecinden posix_spawn ile başlatır (yedek yol)
+ *
+ * posix_spawn exec'ten önce setrlimit çağıramadığı için kaynak sınırları
+ * başlatmadan hemen sonra prlimit ile konur; komut bu arada birkaç komut
+ * çalıştırmış olabilir. Sınır konamazsa süreç sonlandırılır ve hata döner.
+ * FIFO ve aygıt yönlendirmeleri open_special_target ile önceden açılır.
+ *
+ * @return pid_t PID veya hata için -1 (*error doldurulur)
+ */
+static pid_t spawn_direct(const LaunchSpec *spec, LaunchError *error) {
+    posix_spawn_file_actions_t actions;
+    posix_spawnattr_t attr;
+    pid_t pid = -1;
+    int rc;
+    int dir = spec->cwd_fd != -1 ? spec->cwd_fd : AT_FDCWD;
+    int *opened = spec->nredirects ? g_new(int, spec->nredirects) : NULL; // open_special_target fd'leri
+    int nopened = 0;
+
+    if ((rc = posix_spawn_file_actions_init(&actions)) != 0) {
+        g_free(opened);
+        error->code = rc;
+        return -1;
+    }
+    if ((rc = posix_spawnattr_init(&attr)) != 0) {
+        posix_spawn_file_actions_destroy(&actions);
+        g_free(opened);
+        error->code = rc;
+        return -1;
+    }
+
+    // Çocuk, GUI'nin sinyal maskesini ve yok sayılan sinyallerini miras almasın
+    sigset_t mask, defaults;
+    sigemptyset(&mask);
+    sigemptyset(&defaults);
+    sigaddset(&defaults, SIGPIPE);
+    sigaddset(&defaults, SIGINT);
+    sigaddset(&defaults, SIGQUIT);
+    posix_spawnattr_setsigmask(&attr, &mask);
+    posix_spawnattr_setsigdefault(&attr, &defaults);
+    short flags = POSIX_SPAWN_SETSIGMASK | POSIX_SPAWN_SETSIGDEF;
+    if (spec->pgid >= 0) {
+        flags |= POSIX_SPAWN_SETPGROUP;
+        posix_spawnattr_setpgroup(&attr, spec->pgid);
+    }
+    posix_spawnattr_setflags(&attr, flags);
+
+    // Dizin önce değişir ki göreli yönlendirme yolları ve komut yolu ona göre çözülsün
+    rc = add_fchdir(&actions, spec->cwd_fd);
+    if (rc == 0) rc = add_redirect(&actions, spec->stdin_fd, STDIN_FILENO);
+    if (rc == 0) rc = add_redirect(&actions, spec->stdout_fd, STDOUT_FILENO);
+    if (rc == 0) rc = add_redirect(&actions, spec->stderr_fd, STDERR_FILENO);
+    int failed_redirect = -1;
+    for (int i = 0; rc == 0 && i < spec->nredirects; i++) {
+        const LaunchRedirect *r = &spec->redirects[i];
+        int fd = r->path ? open_special_target(dir, r) : -1;
+        if (fd == -2) {
+            rc = errno;
+            failed_redirect = i;
+        } else if (fd != -1) {
+            opened[nopened++] = fd;
+            rc = posix_spawn_file_actions_adddup2(&actions, fd, r->fd);
+        } else if (r->path) {
+            rc = posix_spawn_file_actions_addopen(&actions, r->fd, r->path, r->flags, 0666);
+        } else {
+            rc = posix_spawn_file_actions_adddup2(&actions, r->dup_from, r->fd);
+        }
+    }
+    if (rc == 0) {
+        char *const *envp = spec->envp ? spec->envp : environ;
+        if (spec->path) {
+            rc = posix_spawn(&pid, spec->path, &actions, &attr, spec->argv, envp);
+        } else {
+            rc = posix_spawnp(&pid, spec->argv[0], &actions, &attr, spec->argv, envp);
+        }
+    }
+
+    posix_spawnattr_destroy(&attr);
+    posix_spawn_file_actions_destroy(&actions);
+    for (int i = 0; i < nopened; i++) close(opened[i]);
+    g_free(opened);
+
+    if (rc != 0) {
+        error->code = rc;
+        error->redirect = failed_redirect;
+        // posix_spawn hangi adımın başarısız olduğunu söylemez; açılamayan bir
+        // girdi dosyası varsa hatayı ona bağla
+        for (int i = 0; failed_redirect == -1 && i < spec->nredirects; i++) {
+            const LaunchRedirect *r = &spec->redirects[i];
+            if (r->path && (r->flags & O_ACCMODE) == O_RDONLY && faccessat(dir, r->path, R_OK, 0) == -1) {
+                error->redirect = i;
+                break;
+            }
+        }
+        return -1;
+    }
+
+    for (int i = 0; i < spec->nlimits; i++) {
+        struct rlimit rl = { .rlim_cur = spec->limits[i].soft, .rlim_max = spec->limits[i].hard };
+        if (prlimit(pid, spec->limits[i].resource, &rl, NULL) == -1) {
+            error->code = errno;
+            kill(pid, SIGKILL);
+            waitpid(pid, NULL, 0);
+            return -1;
+        }
+    }
+    return pid;
+}
+
+/**
+ * @brief Doğrudan başlatılan bir çocuk toplandığında GLib tarafından çağrılır
+ */
+static void on_direct_child_exited(GPid pid, gint status, gpointer user_data) {
+    PendingExit *pe = user_data;
+    pe->callback(pid, status, NULL, pe->user_data); // GLib kaynak kullanımını vermez
+    g_free(pe);
+}
+
+/**
+ * @brief Doğrudan başlatılan çocuğun pidfd'si okunabilir olduğunda (süreç çıktığında) çağrılır
+ */
+static gboolean on_direct_child_pidfd(gint fd, GIOCondition condition, gpointer user_data) {
+    PendingExit *pe = user_data;
+    int status = 0;
+    struct rusage ru;
+    pid_t r;
+    do {
+        r = wait4(pe->pid, &status, WNOHANG, &ru);
+    } while (r == -1 && errno == EINTR);
+    if (r == 0) return G_SOURCE_CONTINUE; // Henüz çıkmamış
+
+    close(fd);
+    if (r == pe->pid) {
+        LaunchUsage usage;
+        fill_usage(&usage, &ru);
+        pe->callback(pe->pid, status, &usage, pe->user_data);
+    } else {
+        pe->callback(pe->pid, -1, NULL, pe->user_data);
+    }
+    g_free(pe);
+    return G_SOURCE_REMOVE;
+}
+
+/**
+ * @brief Süreç için pidfd açar (pidfd_open, Linux 5.3+)
+ * @return int pidfd veya desteklenmiyorsa -1
+ */
+static int open_pidfd(pid_t pid) {
+#ifdef SYS_pidfd_open
+    return (int)syscall(SYS_pidfd_open, pid, 0);
+#else
+    (void)pid;
+    errno = ENOSYS;
+    return -1;
+#endif
+}
+
+/**
+ * @brief LaunchSpec'e göre yeni bir süreç başlatır
+ *
+ * spec->path verilmişse doğrudan o dosya çalıştırılır, aksi halde komut PATH
+ * içinde aranır. spec->cwd_fd verilmişse çocuk o dizinde başlar; GUI sürecinin
+ * kendi çalışma dizini hiç değişmez. Çağıranın açık tuttuğu diğer fd'lerin O_CLOEXEC ile
+ * açılmış olması beklenir. Süreç sonlandığında (toplandıktan sonra) on_exit
+ * ana döngüden çağrılır.
+ *
+ * @param spec Başlatma tanımı
+ * @param on_exit Süreç sonlandığında çağrılacak fonksiyon
+ * @param user_data on_exit'e aktarılacak veri
+ * @param error Hata durumunda errno ve başarısız yönlendirme yazılır (NULL olabilir)
+ * @return pid_t Yeni sürecin PID'i veya hata durumunda -1
+ */
+pid_t launcher_spawn(const LaunchSpec *spec, LaunchExitCallback on_exit, void *user_data, LaunchError *error) {
+    LaunchError err = { .code = 0, .redirect = -1 };
+    uint64_t spawn_ns = 0;
+    uint64_t start = now_ns();
+    pid_t pid = -2;
+
+    if (helper_ctl != -1) {
+        if (!pending) pending = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, g_free);
+        if (!helper_watch) {
+            helper_watch = g_unix_fd_add(helper_evt, G_IO_IN | G_IO_HUP | G_IO_ERR, on_helper_event, NULL);
+        }
+        pid = spawn_via_helper(spec, &err, &spawn_ns);
+        if (pid == -2) helper_disconnect(); // Yardımcı yanıt vermiyor, yedek yola geç
+        if (pid == -3) pid = -2;             // Büyük istek: yalnızca bu komut yedek yoldan
+    }
+
+    int helper = pid != -2;
+    if (!helper) {
+        pid = spawn_direct(spec, &err);
+        spawn_ns = now_ns() - start;
+    }
+    if (pid == -1) {
+        if (error) *error = err;
+        return -1;
+    }
+    record_spawn(spawn_ns, now_ns() - start, helper);
+
+    PendingExit *pe = g_new0(PendingExit, 1);
+    pe->callback = on_exit;
+    pe->user_data = user_data;
+    pe->pid = pid;
+    pe->pidfd = -1;
+    if (helper) {
+        g_hash_table_insert(pending, GINT_TO_POINTER(pid), pe);
+    } else if ((pe->pidfd = open_pidfd(pid)) != -1) {
+        g_unix_fd_add(pe->pidfd, G_IO_IN | G_IO_HUP | G_IO_ERR, on_direct_child_pidfd, pe);
+    } else {
+        g_child_watch_add(pid, on_direct_child_exited, pe); // pidfd yoksa GLib'in SIGCHLD izleyicisi
+    }
+    return pid;
+}
+
+/**
+ * @brief Başlatma süresi istatistiklerini döndürür
+ */
+const LaunchStats* launcher_get_stats(void) {
+    return &stats;
+}
+
+/**
+ * @brief Yardımcı sürecin PID'ini döndürür (-1 = çalışmıyor)
+ */
+int launcher_helper_pid(void) {
+    return helper_pid;
+}
+
+/**
+ * @brief Yardımcı süreci kapatır (soketler kapanınca yardımcı kendiliğinden çıkar)
+ */
+void launcher_shutdown(void) {
+    pid_t pid = helper_pid;
+    helper_pid = -1;
+    helper_disconnect();
+    if (pid > 0) waitpid(pid, NULL, 0);
+}
@@ -0,0 +1,94 @@
+#ifndef LAUNCHER_H
+#define LAUNCHER_H
+
+#include <sys/types.h>
+#include <stdint.h>
+
+/**
+ * @brief Çocukta, temel fd'ler bağlandıktan sonra sırayla uygulanan yönlendirme
+ *
+ * path NULL değilse dosya çocukta açılır ve fd'ye bağlanır ("> dosya"),
+ * NULL ise dup_from fd'ye kopyalanır ("2>&1").
+ */
+typedef struct {
+    int fd;                   // Hedef fd (0, 1 veya 2)
+    int flags;                // open() bayrakları (path için)
+    const char *path;         // Açılacak dosya veya NULL
+    int dup_from;             // path NULL ise kopyalanacak fd
+} LaunchRedirect;
+
+/**
+ * @brief Çocukta exec'ten hemen önce setrlimit ile uygulanan kaynak sınırı
+ */
+typedef struct {
+    int resource;             // RLIMIT_CPU, RLIMIT_AS, RLIMIT_NOFILE ...
+    uint64_t soft;            // Yumuşak sınır
+    uint64_t hard;            // Sert sınır
+} LaunchLimit;
+
+/**
+ * @brief Çocuk sürecin nasıl başlatılacağını tanımlayan yapı
+ *
+ * -1 olan dosya tanımlayıcıları ebeveynden olduğu gibi miras alınır. Aynı
+ * env_id ile verilen envp yardımcıya yalnızca bir kez gönderilir; sonraki
+ * başlatmalar ortamın boyutundan bağımsız olarak yalnızca kimliği taşır.
+ */
+typedef struct {
+    char *const *argv;        // NULL ile biten argüman dizisi (argv[0] = komut)
+    const char *path;         // Çalıştırılacak dosyanın mutlak yolu (NULL = PATH'te ara)
+    int stdin_fd;             // Çocuğun stdin'i olacak fd
+    int stdout_fd;            // Çocuğun stdout'u olacak fd
+    int stderr_fd;            // Çocuğun stderr'i olacak fd
+    pid_t pgid;               // Süreç grubu: -1 = değiştirme, 0 = yeni grup, >0 = gruba katıl
+    int cwd_fd;               // Çocuğun çalışma dizini (fchdir ile uygulanır, -1 = miras al)
+    const LaunchRedirect *redirects; // Sırayla uygulanacak yönlendirmeler
+    int nredirects;           // Yönlendirme sayısı
+    const LaunchLimit *limits; // Uygulanacak kaynak sınırları
+    int nlimits;              // Sınır sayısı
+    char *const *envp;        // Çocuğun ortamı (NULL = GUI'nin environ'u)
+    uint64_t env_id;          // envp'nin içeriği değiştikçe değişen kimlik (0 = her seferinde gönder)
+} LaunchSpec;
+
+/**
+ * @brief Başlatma hatası
+ */
+typedef struct {
+    int code;                 // errno değeri
+    int redirect;             // Hataya yol açan yönlendirmenin indeksi (-1 = komutun kendisi)
+} LaunchError;
+
+/**
+ * @brief Başlatma süreleri istatistikleri (nanosaniye)
+ */
+typedef struct {
+    unsigned long count;      // Başarılı başlatma sayısı
+    unsigned long via_helper; // Yardımcı süreç üzerinden yapılanlar
+    uint64_t last_ns;         // Son başlatmanın süresi
+    uint64_t min_ns;          // En kısa süre
+    uint64_t max_ns;          // En uzun süre
+    uint64_t total_ns;        // Toplam süre (ortalama için)
+    uint64_t total_rtt_ns;    // GUI tarafında ölçülen toplam gidiş-dönüş süresi
+} LaunchStats;
+
+/**
+ * @brief Sonlanan sürecin kaynak kullanımı (wait4 ile toplanır)
+ */
+typedef struct {
+    uint64_t exit_ns;         // Sürecin toplandığı an (CLOCK_MONOTONIC)
+    uint64_t user_us;         // Kullanıcı kipinde harcanan CPU süresi
+    uint64_t sys_us;          // Çekirdek kipinde harcanan CPU süresi
+    long max_rss_kb;          // En yüksek yerleşik bellek (KB)
+    long major_faults;        // Diskten okuma gerektiren sayfa hataları
+} LaunchUsage;
+
+// Süreç sonlandığında çağrılır; status waitpid durumudur (-1 = bilinmiyor),
+// usage kaynak kullanımıdır (NULL = bilinmiyor)
+typedef void (*LaunchExitCallback)(pid_t pid, int status, const LaunchUsage *usage, void *user_data);
+
+void launcher_start_helper(void);
+void launcher_shutdown(void);
+pid_t launcher_spawn(const LaunchSpec *spec, LaunchExitCallback on_exit, void *user_data, LaunchError *error);
+const LaunchStats* launcher_get_stats(void);
+int launcher_helper_pid(void);
+
+#endif
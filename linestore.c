@@ -0,0 +1,389 @@
+/**
+ * @file linestore.c
+ * @brief Sanal (virtualized) çıktı görünümü için satır deposu
+ * 
+ * GtkTextView tamponun tamamını yerleştirdiğinden milyonlarca satırda
+ * kaydırma ve yeniden boyutlandırma yavaşlar. LineStore çıktıyı yalnızca
+ * sona eklenen parçalarda (chunk) tutar ve GListModel olarak sunar;
+ * GtkListView yalnızca ekranda görünen satırlar için öğe ister.
+ * 
+ * Her parça en fazla LINES_PER_CHUNK satır veya CHUNK_BYTES bayt tutar.
+ * Satırlar '\n' dahil tek bir metin dizisinde, başlangıç konumlarıyla
+ * saklanır; renkler stil değişim noktalarıyla (StyleSpan) tutulur. Geri
+ * kaydırma sınırı aşıldığında baştaki parçalar bütün olarak atılır.
+ */
+
+#include <string.h>
+#include "linestore.h"
+#include "view.h"
+
+#define LINES_PER_CHUNK 4096        // Parça başına en fazla satır
+#define CHUNK_BYTES (256 * 1024)    // Bu boyutu aşan parçaya yeni satır eklenmez
+
+typedef struct {
+    guint32 offset;   // Stilin başladığı konum (parça metninde)
+    guint32 style;    // line_store_style kimliği
+} StyleSpan;
+
+typedef struct {
+    guint64 first;    // İlk satırın mutlak numarası
+    char *text;       // Satırlar, '\n' dahil art arda
+    gsize len;
+    gsize cap;
+    guint32 *starts;  // Satır başlangıçları (LINES_PER_CHUNK)
+    guint nlines;
+    StyleSpan *spans; // Stil değişimleri, konuma göre sıralı
+    guint nspans;
+    guint spancap;
+} LineChunk;
+
+typedef struct {
+    char *color;
+    int attrs;        // VIEW_ATTR_*
+    GdkRGBA rgba;
+    gboolean parsed;  // Renk adı çözülebildi mi
+} LineStyle;
+
+struct _LineStore {
+    GObject parent_instance;
+    GPtrArray *chunks;    // LineChunk*, eskiden yeniye
+    guint64 base;         // Depodaki ilk satırın mutlak numarası
+    guint64 end;          // Son satırdan sonraki mutlak numara
+    gboolean open;        // Son satır henüz '\n' ile bitmedi
+    guint known;          // Görünüme bildirilen öğe sayısı (items-changed)
+    gboolean known_open;  // Bildirilen son satır açıktı: sonradan uzamış olabilir
+    guint64 bytes;        // Parçalardaki toplam metin
+    GArray *styles;       // LineStyle
+    guint last_chunk;     // Son aranan parça (ardışık satır istekleri için)
+};
+
+static void line_store_model_init(GListModelInterface *iface);
+
+G_DEFINE_TYPE_WITH_CODE(LineStore, line_store, G_TYPE_OBJECT,
+                        G_IMPLEMENT_INTERFACE(G_TYPE_LIST_MODEL, line_store_model_init))
+
+/**
+ * @brief Parçayı serbest bırakır (GPtrArray free func)
+ */
+static void line_chunk_free(gpointer data) {
+    LineChunk *chunk = data;
+    g_free(chunk->text);
+    g_free(chunk->starts);
+    g_free(chunk->spans);
+    g_free(chunk);
+}
+
+/**
+ * @brief Mutlak satır numarasını içeren parçayı bulur
+ * 
+ * GtkListView çoğunlukla komşu satırları istediğinden önce son bulunan
+ * parçaya bakılır, değilse parça başlangıçlarında ikili arama yapılır.
+ * 
+ * @param store Depo
+ * @param line Mutlak satır numarası (base <= line < end)
+ * @return LineChunk* Parça
+ */
+static LineChunk* find_chunk(LineStore *store, guint64 line) {
+    GPtrArray *chunks = store->chunks;
+    if (store->last_chunk < chunks->len) {
+        LineChunk *chunk = g_ptr_array_index(chunks, store->last_chunk);
+        if (line >= chunk->first && line < chunk->first + chunk->nlines) return chunk;
+    }
+    guint lo = 0, hi = chunks->len;
+    while (hi - lo > 1) {
+        guint mid = (lo + hi) / 2;
+        LineChunk *chunk = g_ptr_array_index(chunks, mid);
+        if (chunk->first <= line) lo = mid;
+        else hi = mid;
+    }
+    store->last_chunk = lo;
+    return g_ptr_array_index(chunks, lo);
+}
+
+/**
+ * @brief Satırın parçadaki başlangıcını ve ('\n' hariç) uzunluğunu verir
+ */
+static const char* chunk_line(const LineChunk *chunk, guint index, gsize *len) {
+    gsize start = chunk->starts[index];
+    gsize stop = index + 1 < chunk->nlines ? chunk->starts[index + 1] : chunk->len;
+    if (stop > start && chunk->text[stop - 1] == '\n') stop--;
+    *len = stop - start;
+    return chunk->text + start;
+}
+
+/**
+ * @brief Parçaya bayt ekler, gerekirse kapasiteyi ikiye katlar
+ */
+static void chunk_put(LineChunk *chunk, const char *data, gsize len, guint32 style) {
+    if (chunk->len + len > chunk->cap) {
+        chunk->cap = MAX(chunk->cap * 2, chunk->len + len);
+        chunk->text = g_realloc(chunk->text, chunk->cap);
+    }
+    // Stil yalnızca değiştiği yerde kaydedilir
+    if (chunk->nspans == 0 || chunk->spans[chunk->nspans - 1].style != style) {
+        if (chunk->nspans == chunk->spancap) {
+            chunk->spancap = chunk->spancap ? chunk->spancap * 2 : 16;
+            chunk->spans = g_realloc_n(chunk->spans, chunk->spancap, sizeof(StyleSpan));
+        }
+        chunk->spans[chunk->nspans++] = (StyleSpan){ (guint32)chunk->len, style };
+    }
+    memcpy(chunk->text + chunk->len, data, len);
+    chunk->len += len;
+}
+
+/**
+ * @brief Yeni bir satır başlatır; son parça doluysa yeni parça açar
+ */
+static LineChunk* start_line(LineStore *store) {
+    LineChunk *chunk = store->chunks->len ? g_ptr_array_index(store->chunks, store->chunks->len - 1) : NULL;
+    if (!chunk || chunk->nlines == LINES_PER_CHUNK || chunk->len >= CHUNK_BYTES) {
+        chunk = g_new0(LineChunk, 1);
+        chunk->first = store->end;
+        chunk->starts = g_new(guint32, LINES_PER_CHUNK);
+        g_ptr_array_add(store->chunks, chunk);
+    }
+    chunk->starts[chunk->nlines++] = (guint32)chunk->len;
+    store->end++;
+    store->open = TRUE;
+    return chunk;
+}
+
+/**
+ * @brief Stil için kimlik döndürür; yoksa bir kez ekler
+ * 
+ * @param store Depo
+ * @param color Ön plan rengi (CSS renk adı veya #rrggbb)
+ * @param attrs VIEW_ATTR_* bayrakları
+ * @return int Stil kimliği
+ */
+int line_store_style(LineStore *store, const char *color, int attrs) {
+    for (guint i = 0; i < store->styles->len; i++) {
+        LineStyle *style = &g_array_index(store->styles, LineStyle, i);
+        if (style->attrs == attrs && strcmp(style->color, color) == 0) return (int)i;
+    }
+    LineStyle style = { 0 };
+    style.color = g_strdup(color);
+    style.attrs = attrs;
+    style.parsed = gdk_rgba_parse(&style.rgba, color);
+    g_array_append_val(store->styles, style);
+    return (int)store->styles->len - 1;
+}
+
+/**
+ * @brief Metni depoya ekler
+ * 
+ * Görünüme henüz bildirilmez; bir karedeki tüm eklemeler line_store_commit
+ * ile tek items-changed sinyaliyle duyurulur.
+ * 
+ * @param store Depo
+ * @param text Eklenecek metin (birden çok satır içerebilir)
+ * @param len Metnin bayt uzunluğu
+ * @param style line_store_style kimliği
+ */
+void line_store_append(LineStore *store, const char *text, gsize len, int style) {
+    while (len > 0) {
+        LineChunk *chunk = store->open ? g_ptr_array_index(store->chunks, store->chunks->len - 1)
+                                       : start_line(store);
+        const char *newline = memchr(text, '\n', len);
+        gsize piece = newline ? (gsize)(newline - text) + 1 : len;
+        chunk_put(chunk, text, piece, (guint32)style);
+        store->bytes += piece;
+        if (newline) store->open = FALSE;
+        text += piece;
+        len -= piece;
+    }
+}
+
+/**
+ * @brief Son bildirimden beri eklenen satırları görünüme duyurur
+ * 
+ * Açık kalan son satır uzamış olabileceğinden yeniden gönderilir.
+ * 
+ * @param store Depo
+ */
+void line_store_commit(LineStore *store) {
+    guint total = (guint)(store->end - store->base);
+    if (total == store->known && !store->known_open) return;
+    guint position = store->known_open ? store->known - 1 : store->known;
+    guint removed = store->known - position;
+    store->known = total;
+    store->known_open = store->open;
+    g_list_model_items_changed(G_LIST_MODEL(store), position, removed, total - position);
+}
+
+/**
+ * @brief Sınırı aşan en eski parçaları atar
+ * 
+ * Yalnızca bütün parçalar atılır; kalan satır/bayt sınırın altına inmez.
+ * Son parça (açık satırı içerebilir) hiç atılmaz. Bekleyen eklemeler önce
+ * line_store_commit ile duyurulmuş olmalıdır.
+ * 
+ * @param store Depo
+ * @param max_lines Satır sınırı (0 = sınırsız)
+ * @param max_bytes Bayt sınırı (0 = sınırsız)
+ * @return guint Atılan satır sayısı
+ */
+guint line_store_trim(LineStore *store, guint64 max_lines, guint64 max_bytes) {
+    guint drop = 0, removed = 0;
+    guint64 lines = store->end - store->base;
+    guint64 bytes = store->bytes;
+    while (drop + 1 < store->chunks->len) {
+        LineChunk *chunk = g_ptr_array_index(store->chunks, drop);
+        gboolean over_lines = max_lines && lines - chunk->nlines >= max_lines;
+        gboolean over_bytes = max_bytes && bytes - chunk->len >= max_bytes;
+        if (!over_lines && !over_bytes) break;
+        lines -= chunk->nlines;
+        bytes -= chunk->len;
+        removed += chunk->nlines;
+        drop++;
+    }
+    if (drop == 0) return 0;
+
+    g_ptr_array_remove_range(store->chunks, 0, drop);
+    store->base += removed;
+    store->bytes = bytes;
+    store->last_chunk = 0;
+    store->known -= removed;
+    g_list_model_items_changed(G_LIST_MODEL(store), 0, removed, 0);
+    return removed;
+}
+
+/**
+ * @brief Tüm satırları siler ("clear")
+ */
+void line_store_clear(LineStore *store) {
+    guint known = store->known;
+    g_ptr_array_set_size(store->chunks, 0);
+    store->base = store->end;
+    store->open = FALSE;
+    store->bytes = 0;
+    store->known = 0;
+    store->known_open = FALSE;
+    store->last_chunk = 0;
+    if (known) g_list_model_items_changed(G_LIST_MODEL(store), 0, known, 0);
+}
+
+/**
+ * @brief Depodaki satır sayısı (henüz duyurulmamışlar dahil)
+ */
+guint line_store_get_n_lines(LineStore *store) {
+    return (guint)(store->end - store->base);
+}
+
+/**
+ * @brief Depodaki metnin bayt sayısı
+ */
+guint64 line_store_get_bytes(LineStore *store) {
+    return store->bytes;
+}
+
+/**
+ * @brief Kayıtlı stil sayısı ("meminfo" için)
+ */
+guint line_store_get_n_styles(LineStore *store) {
+    return store->styles->len;
+}
+
+/**
+ * @brief Satırın renk/biçim özniteliklerini oluşturur
+ * 
+ * Satırla kesişen stil değişimleri ikili aramayla bulunur; konumlar satırın
+ * kendi metnine göredir (GtkLabel'a verilecek metin).
+ * 
+ * @param store Depo
+ * @param position Görünümdeki satır numarası
+ * @return PangoAttrList* Öznitelikler (pango_attr_list_unref ile bırakılır)
+ */
+PangoAttrList* line_store_get_attrs(LineStore *store, guint position) {
+    PangoAttrList *list = pango_attr_list_new();
+    if (position >= line_store_get_n_lines(store)) return list;
+    LineChunk *chunk = find_chunk(store, store->base + position);
+    guint index = (guint)(store->base + position - chunk->first);
+    gsize len;
+    const char *line = chunk_line(chunk, index, &len);
+    guint32 start = (guint32)(line - chunk->text), stop = start + (guint32)len;
+
+    guint lo = 0, hi = chunk->nspans;
+    while (hi - lo > 1) {
+        guint mid = (lo + hi) / 2;
+        if (chunk->spans[mid].offset <= start) lo = mid;
+        else hi = mid;
+    }
+    for (guint i = lo; i < chunk->nspans && chunk->spans[i].offset < stop; i++) {
+        guint32 from = MAX(chunk->spans[i].offset, start) - start;
+        guint32 to = (i + 1 < chunk->nspans ? MIN(chunk->spans[i + 1].offset, stop) : stop) - start;
+        const LineStyle *style = &g_array_index(store->styles, LineStyle, chunk->spans[i].style);
+        PangoAttribute *attrs[3];
+        int n = 0;
+        if (style->parsed) {
+            attrs[n++] = pango_attr_foreground_new((guint16)(style->rgba.red * 65535),
+                                                   (guint16)(style->rgba.green * 65535),
+                                                   (guint16)(style->rgba.blue * 65535));
+        }
+        if (style->attrs & VIEW_ATTR_BOLD) attrs[n++] = pango_attr_weight_new(PANGO_WEIGHT_BOLD);
+        if (style->attrs & VIEW_ATTR_UNDERLINE) attrs[n++] = pango_attr_underline_new(PANGO_UNDERLINE_SINGLE);
+        for (int k = 0; k < n; k++) {
+            attrs[k]->start_index = from;
+            attrs[k]->end_index = to;
+            pango_attr_list_insert(list, attrs[k]);
+        }
+    }
+    return list;
+}
+
+// ------------------- GListModel -------------------
+
+static GType line_store_get_item_type(GListModel *model) {
+    return GTK_TYPE_STRING_OBJECT;
+}
+
+static guint line_store_get_n_items(GListModel *model) {
+    return LINE_STORE(model)->known; // Duyurulmamış satırlar görünmez
+}
+
+/**
+ * @brief Görünen satır için öğe üretir (yalnızca GtkListView istediğinde)
+ */
+static gpointer line_store_get_item(GListModel *model, guint position) {
+    LineStore *store = LINE_STORE(model);
+    if (position >= store->known) return NULL;
+    LineChunk *chunk = find_chunk(store, store->base + position);
+    gsize len;
+    const char *line = chunk_line(chunk, (guint)(store->base + position - chunk->first), &len);
+    char *text = g_strndup(line, len);
+    GtkStringObject *item = gtk_string_object_new(text);
+    g_free(text);
+    return item;
+}
+
+static void line_store_model_init(GListModelInterface *iface) {
+    iface->get_item_type = line_store_get_item_type;
+    iface->get_n_items = line_store_get_n_items;
+    iface->get_item = line_store_get_item;
+}
+
+static void line_store_finalize(GObject *object) {
+    LineStore *store = LINE_STORE(object);
+    g_ptr_array_free(store->chunks, TRUE);
+    for (guint i = 0; i < store->styles->len; i++) {
+        g_free(g_array_index(store->styles, LineStyle, i).color);
+    }
+    g_array_free(store->styles, TRUE);
+    G_OBJECT_CLASS(line_store_parent_class)->finalize(object);
+}
+
+static void line_store_class_init(LineStoreClass *klass) {
+    G_OBJECT_CLASS(klass)->finalize = line_store_finalize;
+}
+
+static void line_store_init(LineStore *store) {
+    store->chunks = g_ptr_array_new_with_free_func(line_chunk_free);
+    store->styles = g_array_new(FALSE, FALSE, sizeof(LineStyle));
+}
+
+/**
+ * @brief Boş bir depo oluşturur
+ */
+LineStore* line_store_new(void) {
+    return g_object_new(LINE_TYPE_STORE, NULL);
+}
@@ -0,0 +1,22 @@
+#ifndef LINESTORE_H
+#define LINESTORE_H
+
+#include <gtk/gtk.h>
+
+// Sekme çıktısının satırlarını parça parça (chunk) tutan, yalnızca sona
+// eklenen GListModel. GtkListView ile yalnızca görünen satırlar çizilir.
+#define LINE_TYPE_STORE (line_store_get_type())
+G_DECLARE_FINAL_TYPE(LineStore, line_store, LINE, STORE, GObject)
+
+LineStore* line_store_new(void);
+int line_store_style(LineStore *store, const char *color, int attrs);
+void line_store_append(LineStore *store, const char *text, gsize len, int style);
+void line_store_commit(LineStore *store);
+guint line_store_trim(LineStore *store, guint64 max_lines, guint64 max_bytes);
+void line_store_clear(LineStore *store);
+guint line_store_get_n_lines(LineStore *store);
+guint64 line_store_get_bytes(LineStore *store);
+guint line_store_get_n_styles(LineStore *store);
+PangoAttrList* line_store_get_attrs(LineStore *store, guint position);
+
+#endif
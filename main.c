@@ -8,6 +8,7 @@
 
 #include "controller.h"
 #include "model.h"
+#include "launcher.h"
 
 /**
  * @brief Programın ana fonksiyonu
@@ -17,13 +18,16 @@
  * @return int Program çıkış kodu (başarılı: 0)
  * 
  * Uygulama akışı:
- * 1. Paylaşılan belleği başlatır
- * 2. Controller'ı çalıştırır
- * 3. Program sonlandığında kaynakları temizler
+ * 1. Komutları başlatacak yardımcı süreci, GTK yüklenmeden önce başlatır
+ * 2. Paylaşılan belleği başlatır
+ * 3. Controller'ı çalıştırır
+ * 4. Program sonlandığında kaynakları temizler
  */
 int main(int argc, char **argv) {
+    launcher_start_helper();     // Süreç küçükken yardımcıyı fork et
     model_init_shared_memory();  // Paylaşılan belleği başlat
     controller_start(argc, argv); // Controller'ı çalıştır (ana döngü)
     model_cleanup();             // Kaynakları temizle
+    launcher_shutdown();         // Yardımcı süreci kapat
     return 0;
 }
\ No newline at end of file
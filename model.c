@@ -2,12 +2,21 @@
  * @file model.c
  * @brief MVC mimarisinin Model katmanı
  * * Bu modül, veri ve iş mantığını yönetir:
- * - Komut çalıştırma ve process yönetimi (Doğrudan execvp ile)
+ * - Komut çalıştırma ve process yönetimi (yardımcı süreç ile, bkz. launcher.c)
  * - Paylaşılan bellek üzerinden mesajlaşma
  * - Komut geçmişi tutma
+ * - Komut yollarının (PATH) önbelleğe alınması
+ * - Sekme başına çalışma dizinleri (cd, pushd, popd)
+ * - Yerleşik komut tablosu (echo, pwd, printf ... süreç başlatmadan çalışır)
+ * - Komut başına süre ve kaynak sınırları (limit)
+ * - Sekme başına kabuk değişkenleri ve çocuklara verilen ortam (export, unset, $AD)
+ * - Joker karakter genişletmesi (*, ?, [...], **) ve dizin listesi önbelleği
+ * - ";", "&&", "||" ile komut listeleri ve $? çıkış kodu
+ * - Komut yerine koyma: $(...) ve `...`
  * - Sistem kaynaklarının yönetimi
  */
 
+ #define _GNU_SOURCE // pipe2 için
  #include <stdio.h>
  #include <stdlib.h>
  #include <unistd.h>
@@ -20,8 +29,21 @@
  #include <sys/time.h>
  #include <time.h>
  #include <ctype.h> // isspace için
+ #include <errno.h>
+ #include <limits.h>
+ #include <sys/stat.h>
+ #include <sys/inotify.h>
+ #include <sys/resource.h>
+ #include <sys/timerfd.h>
+ #include <sys/ioctl.h>
+ #include <termios.h>
+ #include <dirent.h>
+ #include <fnmatch.h>
+ #include <glib-unix.h> // g_unix_fd_add için
  
+ #include "model.h"
  #include "view.h" // view_append_output için gerekli olabilir
+ #include "launcher.h"
  
  #define MAX_MSG_LEN 256       // Maksimum mesaj uzunluğu
  #define SHM_NAME "/terminal_shm"  // Paylaşılan bellek ismi
@@ -30,18 +52,55 @@
  /**
   * @brief Process bilgilerini tutan veri yapısı
   */
- #define MAX_PROCESSES 100     // Maksimum takip edilebilecek process sayısı
  typedef struct {
      pid_t pid;                // Process ID
      char command[256];        // Çalıştırılan komut
-     int status;               // Durum: 0=çalışıyor, 1=tamamlandı, 2=sonlandırıldı
+     int status;               // Durum: 0=çalışıyor, 1=tamamlandı, 2=sonlandırıldı, 3=durduruldu
      time_t start_time;        // Başlangıç zamanı
      int tab_index;            // Hangi sekmeden başlatıldığı
+     guint64 seq;              // Başlatılma sırası (ps listesini sıralamak için)
+     guint generation;         // Yuva her boşaltıldığında artar (eski tutamaçları geçersiz kılar)
+     int in_use;               // Yuva dolu mu
+     int prev, next;           // Listedeki komşular (-1 = yok); boş yuvada next sıradaki boş yuvadır
+     gint64 start_us;          // Başlatma anı (monoton saat)
+     gint64 end_us;            // Toplandığı an (0 = çalışıyor)
+     int exit_code;            // Kabuk çıkış kodu (-1 = henüz bitmedi)
+     int has_usage;            // Aşağıdaki kaynak kullanımı biliniyor mu
+     guint64 user_us;          // Kullanıcı kipi CPU süresi
+     guint64 sys_us;           // Çekirdek kipi CPU süresi
+     long max_rss_kb;          // En yüksek yerleşik bellek (KB)
+     long major_faults;        // Büyük sayfa hataları
  } ProcessInfo;
  
- // Process tablosu ve sayısı
- static ProcessInfo process_table[MAX_PROCESSES];
- static int process_count = 0;
+ /**
+  * @brief Process tablosundaki bir kaydı gösteren tutamaç
+  * * Yuva serbest bırakılıp yeniden kullanılınca kuşak değişir; böylece PID'si
+  * yeniden kullanılmış başka bir sürecin kaydı yanlışlıkla güncellenmez.
+  */
+ typedef struct {
+     int slot;                 // Yuva indeksi (-1 = geçersiz)
+     guint generation;         // Yuvanın tutamaç alındığı andaki kuşağı
+ } ProcessRef;
+ 
+ /**
+  * @brief Yuva indeksleriyle kurulan çift bağlı liste
+  */
+ typedef struct {
+     int head, tail;
+     int count;
+ } ProcessList;
+ 
+ #define PROCESS_TABLE_INITIAL 64   // Process tablosunun başlangıç kapasitesi
+ #define MAX_FINISHED_PROCESSES 100 // "ps" için saklanan en fazla bitmiş process
+ 
+ // Process tablosu: gerektikçe büyüyen yuva dizisi, boş yuva listesi ve PID indeksi
+ static ProcessInfo *process_table = NULL;
+ static int process_capacity = 0;
+ static int process_free = -1;            // Boş yuva listesinin başı
+ static guint64 process_seq = 0;          // Sonraki başlatılma sırası
+ static ProcessList process_live = { -1, -1, 0 };     // Çalışan / durdurulmuş processler
+ static ProcessList process_finished = { -1, -1, 0 }; // Bitmiş processler (en eskisi başta)
+ static GHashTable *process_index = NULL; // PID -> yuva indeksi + 1 (en yeni kayıt)
  
  // Paylaşılan bellek değişkenleri
  static int shm_fd = -1;
@@ -65,50 +124,175 @@
      output_callback = callback;
  }
  
+ // Sekmenin çalışma dizini değiştiğinde controller'ı bilgilendirmek için callback
+ typedef void (*CwdCallback)(int tab_index, const char *path);
+ static CwdCallback cwd_callback = NULL;
+ 
+ /**
+  * @brief Çalışma dizini değişikliği callback'ini ayarlar
+  * * @param callback Sekme ve yeni dizinin mutlak yolu ile çağrılacak fonksiyon
+  */
+ void model_set_cwd_callback(CwdCallback callback) {
+     cwd_callback = callback;
+ }
+ 
+ /**
+  * @brief Yuvayı bir listenin sonuna ekler
+  */
+ static void process_list_append(ProcessList *list, int slot) {
+     ProcessInfo *proc = &process_table[slot];
+     proc->prev = list->tail;
+     proc->next = -1;
+     if (list->tail != -1) process_table[list->tail].next = slot;
+     else list->head = slot;
+     list->tail = slot;
+     list->count++;
+ }
+ 
+ /**
+  * @brief Yuvayı bulunduğu listeden çıkarır
+  */
+ static void process_list_remove(ProcessList *list, int slot) {
+     ProcessInfo *proc = &process_table[slot];
+     if (proc->prev != -1) process_table[proc->prev].next = proc->next;
+     else list->head = proc->next;
+     if (proc->next != -1) process_table[proc->next].prev = proc->prev;
+     else list->tail = proc->prev;
+     list->count--;
+ }
+ 
+ /**
+  * @brief Durum değerine göre kaydın bulunduğu listeyi döndürür
+  */
+ static ProcessList* process_list_for(int status) {
+     return (status == 1 || status == 2) ? &process_finished : &process_live;
+ }
+ 
+ /**
+  * @brief Bitmiş bir kaydın yuvasını boş listeye geri verir
+  * * @param slot Serbest bırakılacak yuva
+  */
+ static void process_free_slot(int slot) {
+     ProcessInfo *proc = &process_table[slot];
+     process_list_remove(process_list_for(proc->status), slot);
+     // PID daha yeni bir kayda ait olabilir; yalnızca bu yuvayı gösteriyorsa sil
+     if (GPOINTER_TO_INT(g_hash_table_lookup(process_index, GINT_TO_POINTER(proc->pid))) == slot + 1) {
+         g_hash_table_remove(process_index, GINT_TO_POINTER(proc->pid));
+     }
+     proc->in_use = 0;
+     proc->generation++;
+     proc->next = process_free;
+     process_free = slot;
+ }
+ 
+ /**
+  * @brief Boş bir yuva alır; boş yuva kalmadıysa tabloyu iki katına büyütür
+  * * @return int Yuva indeksi veya bellek yetmezse -1
+  */
+ static int process_alloc_slot(void) {
+     if (process_free == -1) {
+         int capacity = process_capacity ? process_capacity * 2 : PROCESS_TABLE_INITIAL;
+         ProcessInfo *table = realloc(process_table, sizeof(ProcessInfo) * capacity);
+         if (!table) return -1;
+         memset(table + process_capacity, 0, sizeof(ProcessInfo) * (capacity - process_capacity));
+         for (int i = capacity - 1; i >= process_capacity; i--) {
+             table[i].next = process_free;
+             process_free = i;
+         }
+         process_table = table;
+         process_capacity = capacity;
+     }
+     int slot = process_free;
+     process_free = process_table[slot].next;
+     return slot;
+ }
+ 
  /**
   * @brief Process tablosuna yeni bir process ekler
+  * * Ekleme, arama ve silme sabit zamanlıdır; tablo dolmaz, gerektikçe büyür.
   * * @param pid Process ID
   * @param command Çalıştırılan komut
   * @param tab_index Komutun çalıştırıldığı sekme
-  * @return int Process tablosundaki indeks veya hata durumunda -1
+  * @return ProcessRef Kaydın tutamacı (hata durumunda slot = -1)
   */
- int add_process(pid_t pid, const char* command, int tab_index) {
-     if (process_count >= MAX_PROCESSES) return -1;
+ ProcessRef add_process(pid_t pid, const char* command, int tab_index) {
+     ProcessRef ref = { -1, 0 };
+     if (!process_index) process_index = g_hash_table_new(g_direct_hash, g_direct_equal);
+     int slot = process_alloc_slot();
+     if (slot == -1) return ref;
      
-     ProcessInfo *proc = &process_table[process_count];
+     ProcessInfo *proc = &process_table[slot];
      proc->pid = pid;
      strncpy(proc->command, command, 255);
      proc->command[255] = '\0';
      proc->status = 0;                  // running
      proc->start_time = time(NULL);     // mevcut zaman
      proc->tab_index = tab_index;
+     proc->seq = process_seq++;
+     proc->start_us = g_get_monotonic_time();
+     proc->end_us = 0;
+     proc->exit_code = -1;
+     proc->has_usage = 0;
+     proc->in_use = 1;
+     process_list_append(&process_live, slot);
+     g_hash_table_insert(process_index, GINT_TO_POINTER(pid), GINT_TO_POINTER(slot + 1));
      
-     return process_count++;
+     ref.slot = slot;
+     ref.generation = proc->generation;
+     return ref;
+ }
+ 
+ /**
+  * @brief Tutamacın gösterdiği kaydı döndürür
+  * * @param ref add_process'in döndürdüğü tutamaç
+  * @return ProcessInfo* Kayıt veya kayıt silinmişse NULL
+  */
+ ProcessInfo* process_get(ProcessRef ref) {
+     if (ref.slot < 0 || ref.slot >= process_capacity) return NULL;
+     ProcessInfo *proc = &process_table[ref.slot];
+     return (proc->in_use && proc->generation == ref.generation) ? proc : NULL;
  }
  
  /**
   * @brief PID'ye göre process tablosunda arama yapar
   * * @param pid Aranacak Process ID
-  * @return ProcessInfo* Bulunan process bilgisi veya NULL
+  * @return ProcessInfo* Bu PID ile başlatılan en son processin bilgisi veya NULL
   */
  ProcessInfo* find_process(pid_t pid) {
-     for (int i = 0; i < process_count; i++) {
-         if (process_table[i].pid == pid) {
-             return &process_table[i];
-         }
+     if (!process_index) return NULL;
+     int index = GPOINTER_TO_INT(g_hash_table_lookup(process_index, GINT_TO_POINTER(pid)));
+     return index > 0 ? &process_table[index - 1] : NULL;
+ }
+ 
+ /**
+  * @brief Kaydın durumunu değiştirir ve gerekirse listesini değiştirir
+  * * Bitmiş kayıtlardan yalnızca en yeni MAX_FINISHED_PROCESSES tanesi saklanır.
+  * * @param proc Güncellenecek kayıt
+  * @param status Yeni durum (0=çalışıyor, 1=tamamlandı, 2=sonlandırıldı, 3=durduruldu)
+  */
+ static void process_set_status(ProcessInfo *proc, int status) {
+     int slot = (int)(proc - process_table);
+     ProcessList *from = process_list_for(proc->status);
+     ProcessList *to = process_list_for(status);
+     proc->status = status;
+     if (from != to) {
+         process_list_remove(from, slot);
+         process_list_append(to, slot);
+     }
+     while (process_finished.count > MAX_FINISHED_PROCESSES) {
+         process_free_slot(process_finished.head);
      }
-     return NULL;
  }
  
  /**
   * @brief Process durumunu günceller
   * * @param pid Güncellenecek process ID
-  * @param status Yeni durum (0=çalışıyor, 1=tamamlandı, 2=sonlandırıldı)
+  * @param status Yeni durum (0=çalışıyor, 1=tamamlandı, 2=sonlandırıldı, 3=durduruldu)
   */
  void update_process_status(pid_t pid, int status) {
      ProcessInfo *proc = find_process(pid);
      if (proc) {
-         proc->status = status;
+         process_set_status(proc, status);
      }
  }
  
@@ -116,62 +300,77 @@
   * @brief Process tablosunu temizler (tamamlanan processleri kaldırır)
   */
  void clean_process_table() {
-     int i = 0;
-     while (i < process_count) {
-         if (process_table[i].status != 0) {
-             // Process çalışmayı bitirmiş, tablodan çıkar
-             if (i < process_count - 1) {
-                 memmove(&process_table[i], &process_table[i+1], 
-                         sizeof(ProcessInfo) * (process_count - i - 1));
-             }
-             process_count--;
-         } else {
-             i++;
-         }
+     while (process_finished.head != -1) {
+         process_free_slot(process_finished.head);
      }
  }
  
  /**
-  * @brief Zombie processleri kontrol edip temizler
-  * * waitpid() ile tamamlanan processleri yakalar ve durumlarını günceller
+  * @brief ps listesini başlatılma sırasına dizmek için karşılaştırma
   */
- void check_zombie_processes() {
-     int status;
-     pid_t pid;
-     
-     while ((pid = waitpid(-1, &status, WNOHANG)) > 0) {
-         ProcessInfo *proc = find_process(pid);
-         if (proc) {
-             proc->status = 1; // completed
-         }
-     }
-     
-     // Belirli aralıklarla process tablosunu temizle
-     // clean_process_table(); // Bunu daha seyrek çağırmak daha verimli olabilir
+ static int compare_process_seq(const void *a, const void *b) {
+     guint64 sa = process_table[*(const int *)a].seq;
+     guint64 sb = process_table[*(const int *)b].seq;
+     return sa < sb ? -1 : sa > sb;
+ }
+ 
+ /**
+  * @brief Mikrosaniye cinsinden süreyi "1.234s" biçiminde yazar
+  * * @param buf Hedef tampon
+  * @param size Tampon boyutu
+  * @param us Süre (mikrosaniye)
+  */
+ static void format_seconds(char *buf, size_t size, guint64 us) {
+     snprintf(buf, size, "%llu.%03llus", (unsigned long long)(us / 1000000),
+              (unsigned long long)(us % 1000000 / 1000));
  }
  
  /**
   * @brief Çalışan tüm processlerin listesini döndürür
-  * * @return char* Process listesi (PID, DURUM, KOMUT formatında)
+  * * Çalışan processler ve son bitenler başlatılma sırasıyla listelenir. Bitenler
+  * için çıkış kodu ve wait4 ile toplanan kaynak kullanımı da gösterilir.
+  * * @return char* Process listesi (PID, DURUM, ÇIKIŞ, SÜRE, CPU, BELLEK, KOMUT formatında)
   */
  char* get_process_list() {
-     static char buffer[4096]; // Güvenli bir boyut
-     buffer[0] = '\0';
-     
-     check_zombie_processes(); // Önce zombie'leri temizle
+     static GString *buffer = NULL; // Tablo büyüdükçe tampon da büyür
+     if (!buffer) buffer = g_string_new(NULL);
+     g_string_truncate(buffer, 0);
      
-     strcat(buffer, "PID\tSTATUS\tCOMMAND\n");
-     for (int i = 0; i < process_count; i++) {
-         char line[512];
-         const char* status_str = process_table[i].status == 0 ? "RUNNING" : 
-                                 (process_table[i].status == 1 ? "DONE" : "KILLED");
+     // Durumlar çocuk süreçler toplandıkça (on_job_exited) güncellenir
+     g_string_append(buffer, "PID\tSTATUS\tEXIT\tWALL\tUSER\tSYS\tMAXRSS\tMAJFLT\tCOMMAND\n");
+     gint64 now = g_get_monotonic_time();
+     int total = process_live.count + process_finished.count;
+     int *order = g_new(int, total > 0 ? total : 1);
+     int n = 0;
+     for (int slot = process_live.head; slot != -1; slot = process_table[slot].next) order[n++] = slot;
+     for (int slot = process_finished.head; slot != -1; slot = process_table[slot].next) order[n++] = slot;
+     qsort(order, n, sizeof(int), compare_process_seq);
+ 
+     for (int i = 0; i < n; i++) {
+         const ProcessInfo *proc = &process_table[order[i]];
+         const char* status_str = proc->status == 0 ? "RUNNING" : 
+                                 (proc->status == 1 ? "DONE" :
+                                 (proc->status == 2 ? "KILLED" : "STOPPED"));
          
-         snprintf(line, sizeof(line), "%d\t%s\t%s\n", 
-                  process_table[i].pid, status_str, process_table[i].command);
-         strcat(buffer, line);
+         char wall[32], user[32], sys[32];
+         format_seconds(wall, sizeof(wall), (proc->end_us ? proc->end_us : now) - proc->start_us);
+         g_string_append_printf(buffer, "%d\t%s\t", proc->pid, status_str);
+         if (proc->exit_code >= 0) g_string_append_printf(buffer, "%d\t", proc->exit_code);
+         else g_string_append(buffer, "-\t");
+         g_string_append_printf(buffer, "%s\t", wall);
+         if (proc->has_usage) {
+             format_seconds(user, sizeof(user), proc->user_us);
+             format_seconds(sys, sizeof(sys), proc->sys_us);
+             g_string_append_printf(buffer, "%s\t%s\t%ldK\t%ld\t", user, sys,
+                                    proc->max_rss_kb, proc->major_faults);
+         } else {
+             g_string_append(buffer, "-\t-\t-\t-\t");
+         }
+         g_string_append_printf(buffer, "%s\n", proc->command);
      }
+     g_free(order);
      
-     return buffer;
+     return buffer->str;
  }
  
  /**
@@ -208,12 +407,11 @@
  
  /**
   * @brief Model katmanını başlatır
-  * * Process tablosunu sıfırlar ve paylaşılan belleği başlatır
+  * * Process tablosunu hazırlar ve paylaşılan belleği başlatır
   */
  void model_init() {
-     // Process tablosunu sıfırla
-     memset(process_table, 0, sizeof(process_table));
-     process_count = 0;
+     // Process tablosu ilk add_process çağrısında ayrılır ve gerektikçe büyür
+     if (!process_index) process_index = g_hash_table_new(g_direct_hash, g_direct_equal);
      
      // Paylaşılan belleği başlat (Eğer main'de zaten çağrılıyorsa burada tekrar çağırmaya gerek yok)
      // model_init_shared_memory(); // Genellikle main'de bir kere çağrılır
@@ -322,6 +520,8 @@
      return history_count;
  }
  
+ static void captures_free_all(void);
+ 
  /**
   * @brief Model tarafından kullanılan kaynakları temizler
   * * Paylaşılan bellek, semafor ve komut geçmişi için ayrılan belleği serbest bırakır
@@ -343,243 +543,4954 @@
          command_history[i] = NULL; // İşaretçiyi NULL yap
      }
      history_count = 0; // Sayacı sıfırla
+ 
+     // Process tablosunu serbest bırak
+     if (process_index) g_hash_table_destroy(process_index);
+     process_index = NULL;
+     free(process_table);
+     process_table = NULL;
+     process_capacity = 0;
+     process_free = -1;
+     process_live = (ProcessList){ -1, -1, 0 };
+     process_finished = (ProcessList){ -1, -1, 0 };
+     captures_free_all(); // "capture open" kopyaları da silinir
  }
  
  
- // ------------------- YENİ EKLENEN KISIM BAŞLANGICI -------------------
+ // ------------------- PATH önbelleği -------------------
  
- #define MAX_ARGS 64 // Bir komut için maksimum argüman sayısı
+ /**
+  * @brief Komut adı -> mutlak yol önbelleğindeki bir kayıt
+  */
+ typedef struct {
+     char *path;               // Çözülmüş mutlak yol (NULL = PATH'te yok)
+     unsigned long hits;       // Bu kaydın kaç kez kullanıldığı
+ } PathEntry;
  
  /**
-  * @brief Komut satırını boşluklara göre ayırır ve argv dizisi oluşturur.
-  * * @param cmdline_orig Ayrıştırılacak orijinal komut satırı string'i.
-  * @param argv Sonuçların yazılacağı char* dizisi (sonu NULL ile bitmeli).
-  * @param max_args argv dizisinin maksimum kapasitesi.
-  * @return int Argüman sayısı veya hata durumunda -1.
-  * * @note Bu fonksiyon basit bir ayrıştırıcıdır, tırnak işaretleri veya
-  * kaçış karakterleri gibi karmaşık durumları işlemez.
-  * strtok_r kullandığı için orijinal string'i değiştirir, bu yüzden kopya kullanılır.
+  * @brief İzlenen (veya izlenmeyi bekleyen) bir PATH dizini
   */
- static int parse_command(const char *cmdline_orig, char *argv[], int max_args) {
-     char *cmdline_copy = strdup(cmdline_orig); // strtok_r orijinali bozar, kopya al
-     if (!cmdline_copy) {
-         perror("strdup failed in parse_command");
-         return -1;
+ typedef struct {
+     char *dir;                // Mutlak dizin yolu
+     int wd;                   // inotify izleme tanımlayıcısı (-1 = dizin yok veya izleme düştü)
+ } PathDir;
+ 
+ #define PATH_RETRY_US G_USEC_PER_SEC // İzlenemeyen PATH dizinleri en fazla bu aralıkla yeniden denenir
+ #define PATH_WATCH_MASK (IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | \
+                          IN_ATTRIB | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR)
+ 
+ static GHashTable *path_cache = NULL;   // Komut adı -> PathEntry
+ static GArray *path_dirs = NULL;        // PATH'teki mutlak dizinler (PathDir), PATH sırasıyla
+ static int path_inotify_fd = -1;        // PATH dizinlerini izleyen inotify
+ static int path_relative = 0;           // GUI'nin PATH'inde göreli dizin var (önbellek kullanılmaz)
+ static guint path_missing = 0;          // İzlenemeyen PATH dizini sayısı
+ static gint64 path_retry_us = 0;        // İzlenemeyen dizinlerin yeniden deneneceği an
+ static unsigned long path_hits = 0;     // Önbellekten çözülen komutlar
+ static unsigned long path_misses = 0;   // PATH taraması gereken komutlar
+ 
+ /**
+  * @brief PathEntry'yi serbest bırakır (GHashTable değer yok edicisi)
+  */
+ static void path_entry_free(gpointer data) {
+     PathEntry *entry = data;
+     free(entry->path);
+     g_free(entry);
+ }
+ 
+ /**
+  * @brief PATH dizinlerinde bir değişiklik olduğunda ilgili kayıtları geçersiz kılar
+  * * Dosya ekleme/silme/taşıma olaylarında yalnızca o addaki kayıt (bulunamadı
+  * kaydı dahil) silinir (önceki bir dizine eklenen aynı adlı dosya sonraki
+  * aramada bulunur). Dizinin kendisi
+  * değiştiğinde veya olay kuyruğu taştığında tüm önbellek temizlenir; izlemesi
+  * düşen dizin path_watch_missing ile yeniden izlenir.
+  */
+ static gboolean on_path_changed(gint fd, GIOCondition condition, gpointer user_data) {
+     char buf[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+     ssize_t n;
+ 
+     while ((n = read(fd, buf, sizeof(buf))) > 0) {
+         for (char *p = buf; p < buf + n; ) {
+             struct inotify_event *ev = (struct inotify_event *)p;
+             if (ev->mask & (IN_Q_OVERFLOW | IN_DELETE_SELF | IN_MOVE_SELF | IN_IGNORED)) {
+                 g_hash_table_remove_all(path_cache);
+                 // Taşınan dizin eski adıyla izlenmeye devam ederdi; izleme bırakılır ve
+                 // IN_IGNORED ile dizin yeniden izlenecekler arasına girer
+                 if (ev->mask & IN_MOVE_SELF) inotify_rm_watch(fd, ev->wd);
+                 if (ev->mask & IN_IGNORED) {
+                     for (guint i = 0; i < path_dirs->len; i++) {
+                         PathDir *d = &g_array_index(path_dirs, PathDir, i);
+                         if (d->wd == ev->wd) {
+                             d->wd = -1;
+                             path_missing++;
+                         }
+                     }
+                     path_retry_us = 0; // Yeniden oluşturulan dizin bir sonraki aramada izlenir
+                 }
+             } else if (ev->len > 0) {
+                 g_hash_table_remove(path_cache, ev->name);
+             }
+             p += sizeof(struct inotify_event) + ev->len;
+         }
+     }
+     return G_SOURCE_CONTINUE;
+ }
+ 
+ /**
+  * @brief İzlenmeyen PATH dizinlerini yeniden izlemeyi dener
+  * * Başlangıçta var olmayan ("mkdir ~/.local/bin" öncesi) veya silinip yeniden
+  * oluşturulan dizinler izlenmediği için içlerine eklenen dosyalar haber
+  * vermez. Önbellek aramasında, izlenemeyen dizin varsa en fazla PATH_RETRY_US
+  * aralıkla bu dizinler için inotify_add_watch denenir; tüm dizinler
+  * izleniyorsa arama hiçbir sistem çağrısı yapmaz. Dizin ortaya çıktıysa,
+  * daha sonraki bir dizine çözülmüş veya bulunamadı diye kaydedilmiş adları
+  * gölgeleyebileceğinden önbellek boşaltılır.
+  */
+ static void path_watch_missing(void) {
+     if (path_inotify_fd == -1 || path_missing == 0) return;
+     gint64 now = g_get_monotonic_time();
+     if (now < path_retry_us) return;
+     path_retry_us = now + PATH_RETRY_US;
+ 
+     int added = 0;
+     path_missing = 0;
+     for (guint i = 0; i < path_dirs->len; i++) {
+         PathDir *d = &g_array_index(path_dirs, PathDir, i);
+         if (d->wd != -1) continue;
+         d->wd = inotify_add_watch(path_inotify_fd, d->dir, PATH_WATCH_MASK);
+         if (d->wd != -1) added = 1;
+         else path_missing++;
      }
+     if (added) g_hash_table_remove_all(path_cache);
+ }
  
-     char *token;
-     char *saveptr; // strtok_r için
-     int arg_count = 0;
-     const char *delimiters = " \t\n\r"; // Ayraçlar: boşluk, tab, yeni satır vs.
+ /**
+  * @brief PATH önbelleğini kurar ve PATH'teki her dizini inotify ile izlemeye başlar
+  */
+ static void path_cache_init(void) {
+     path_cache = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, path_entry_free);
+     path_dirs = g_array_new(FALSE, FALSE, sizeof(PathDir));
  
-     token = strtok_r(cmdline_copy, delimiters, &saveptr);
-     while (token != NULL && arg_count < max_args - 1) { // -1: Son NULL için yer bırak
-         argv[arg_count++] = token;
-         token = strtok_r(NULL, delimiters, &saveptr);
+     const char *path_env = getenv("PATH");
+     char *dirs = strdup(path_env ? path_env : "/usr/local/bin:/usr/bin:/bin");
+     char *saveptr;
+     // Boş girdi (baştaki, sondaki veya "::") de göreli dizindir (".")
+     path_relative = dirs[0] == ':' || strstr(dirs, "::") != NULL ||
+                     (dirs[0] && dirs[strlen(dirs) - 1] == ':');
+     for (char *dir = strtok_r(dirs, ":", &saveptr); dir; dir = strtok_r(NULL, ":", &saveptr)) {
+         if (dir[0] != '/') { // Sonucu sekmenin dizinine bağlı: önbellek kullanılmaz
+             path_relative = 1;
+             continue;
+         }
+         PathDir d = { g_strdup(dir), -1 };
+         g_array_append_val(path_dirs, d);
      }
+     free(dirs);
+     path_missing = path_dirs->len;
  
-     argv[arg_count] = NULL; // Argv dizisini NULL ile sonlandır
+     path_inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+     if (path_inotify_fd == -1) {
+         perror("inotify_init1 failed"); // Önbellek yine çalışır, yalnızca geçersiz kılınmaz
+         return;
+     }
+     path_watch_missing();
+     g_unix_fd_add(path_inotify_fd, G_IO_IN, on_path_changed, NULL);
+ }
  
-     // ÖNEMLİ: argv'deki işaretçiler artık cmdline_copy içindeki yerleri gösteriyor.
-     // Bu yüzden execvp çağrısından *sonra* değil, *önce* free(cmdline_copy)
-     // yapmak execvp çalışırsa mümkün olmaz. Bu bellek sızıntısı yaratır.
-     // Daha iyi bir çözüm: Argümanları da strdup ile kopyalayıp sonra free etmek
-     // veya execvp sonrası ana süreçte kopyayı free etmek (bu örnekte yapılamaz).
-     // Şimdilik bu basit versiyonda sızıntı göz ardı ediliyor veya
-     // execvp başarısız olursa free ediliyor.
+ /**
+  * @brief Komut adını çalıştırılabilir dosyanın yoluna çözer
+  * * '/' içeren adlar olduğu gibi döner. Diğerleri önce önbellekte aranır;
+  * bulunamazsa PATH taranır ve sonuç (bulunamadıysa bu da) önbelleğe eklenir.
+  * Göreli PATH girdileri ("." veya boş) sekmenin dizinine göre denetlenir ve
+  * göreli yol olarak döner; çocuk exec'ten önce aynı dizine geçtiği için yol
+  * orada da geçerlidir. Sonucu sekmeye bağlı olduğundan PATH'inde göreli girdi
+  * olan aramalar önbelleğe alınmaz. Önbellek ve inotify izlemeleri GUI'nin
+  * PATH'ine göre kurulur; sekmede PATH değiştirildiyse her seferinde tarama
+  * yapılır.
+  * * @param name Komut adı (argv[0])
+  * @param search_path Aranacak PATH (NULL = varsayılan dizinler)
+  * @param dirfd Göreli PATH girdilerinin çözüleceği dizin (sekmenin dizini veya AT_FDCWD)
+  * @return const char* Çalıştırılacak yol (bir sonraki çözümlemeye kadar geçerli) veya NULL
+  */
+ static const char* path_resolve(const char *name, const char *search_path, int dirfd) {
+     static char found[PATH_MAX];
+     if (strchr(name, '/')) return name;
+     const char *path_env = getenv("PATH");
+     int cached = search_path && path_env && strcmp(search_path, path_env) == 0;
+     PathEntry *entry = NULL;
+     if (cached) {
+         if (!path_cache) path_cache_init();
+         cached = !path_relative;
+     }
+     if (cached) {
+         path_watch_missing();
+         entry = g_hash_table_lookup(path_cache, name);
+         if (entry) {
+             entry->hits++;
+             path_hits++;
+             return entry->path;
+         }
+         path_misses++;
+     }
  
-     // free(cmdline_copy); // YANLIŞ YER - execvp'den sonra buraya gelinmez
+     const char *p = search_path ? search_path : "/usr/local/bin:/usr/bin:/bin";
+     for (;;) {
+         const char *colon = strchr(p, ':');
+         size_t len = colon ? (size_t)(colon - p) : strlen(p);
+         const char *dir = len ? p : ".";
+         if (len == 0) len = 1;
  
-     if (arg_count == 0) {
-         free(cmdline_copy); // Boş komutsa kopyayı free et
-         return 0; // Boş komut, hata değil ama argüman yok
+         if (snprintf(found, sizeof(found), "%.*s/%s", (int)len, dir, name) < (int)sizeof(found)) {
+             struct stat st;
+             if (fstatat(dirfd, found, &st, 0) == 0 && S_ISREG(st.st_mode) &&
+                 faccessat(dirfd, found, X_OK, 0) == 0) {
+                 if (cached) {
+                     entry = g_new0(PathEntry, 1);
+                     entry->path = strdup(found);
+                     entry->hits = 1;
+                     g_hash_table_replace(path_cache, g_strdup(name), entry);
+                 }
+                 return found;
+             }
+         }
+         if (!colon) break;
+         p = colon + 1;
      }
+     if (cached) { // Adın eklendiği dizinden gelen inotify olayı kaydı siler
+         entry = g_new0(PathEntry, 1);
+         entry->hits = 1;
+         g_hash_table_replace(path_cache, g_strdup(name), entry);
+     }
+     return NULL;
+ }
  
-     // Başarılı ayrıştırma durumunda, free(cmdline_copy) çocuk süreçte
-     // execvp'nin üzerine yazılacağı için yapılamaz. Ana süreçte de yapılamaz.
-     // Bu basit örnekte küçük bir bellek sızıntısı olacaktır. Daha gelişmiş
-     // yöntemler (argümanları da kopyalamak) bu sızıntıyı önleyebilir.
+ /**
+  * @brief PATH önbelleğini gösteren veya temizleyen "hash" komutu
+  * * "hash" kayıtları ve isabet/ıska sayılarını listeler, "hash -r" önbelleği boşaltır.
+  * * @param tab_index Çıktının yazılacağı sekme
+  * @param args Komut adından sonraki argümanlar
+  */
+ static void show_path_cache(int tab_index, const char *args) {
+     if (!path_cache) path_cache_init();
+     while (*args && isspace((unsigned char)*args)) args++;
+     if (strcmp(args, "-r") == 0) {
+         g_hash_table_remove_all(path_cache);
+         if (output_callback) output_callback(tab_index, "PATH önbelleği temizlendi\n", "lightgreen");
+         return;
+     }
  
-     return arg_count;
+     GString *out = g_string_new("isabet\tkomut\n");
+     GHashTableIter it;
+     gpointer key, value;
+     g_hash_table_iter_init(&it, path_cache);
+     while (g_hash_table_iter_next(&it, &key, &value)) {
+         PathEntry *entry = value;
+         if (entry->path) g_string_append_printf(out, "%6lu\t%s\n", entry->hits, entry->path);
+         else g_string_append_printf(out, "%6lu\t%s (bulunamadı)\n", entry->hits, (const char *)key);
+     }
+     guint watched = 0;
+     for (guint i = 0; i < path_dirs->len; i++) {
+         if (g_array_index(path_dirs, PathDir, i).wd != -1) watched++;
+     }
+     g_string_append_printf(out, "Toplam: %lu isabet, %lu ıska, %u kayıt, %u/%u izlenen dizin\n",
+                            path_hits, path_misses, g_hash_table_size(path_cache),
+                            watched, path_dirs->len);
+     if (output_callback) output_callback(tab_index, out->str, "lightgreen");
+     g_string_free(out, TRUE);
  }
  
- // ------------------- YENİ EKLENEN KISIM SONU ---------------------
  
+ // ------------------- YENİ EKLENEN KISIM BAŞLANGICI -------------------
+ 
+ #define MAX_REDIRECTS 8 // Bir komut için maksimum yönlendirme sayısı
+ #define TOKEN_INLINE_WORDS 512 // Kısa satırlar için TokenList içindeki arena (işaretçi sayısı)
+ 
+ // TokenList.flags bitleri
+ #define TOKEN_OP 1     // Tırnaksız bir işleç: |, &, <, >, >>, N<, N>, N>>, &>, &>>, N>&M
+ #define TOKEN_ASSIGN 2 // Tırnaksız "AD=değer" biçimindeki sözcük (değişken ataması)
+ #define TOKEN_GLOB 4   // Tırnaksız *, ? veya [...] içeren sözcük (yalnızca tokenize içinde)
+ #define TOKEN_ESCAPED 8 // Sözcükte tırnaklı joker karakterler \ ile kaçışlandı (yalnızca tokenize içinde)
+ 
+ static const char* var_lookup(int tab_index, const char *name, size_t len);
  
  /**
-  * @brief Komut çalıştırma fonksiyonu (Doğrudan execvp kullanan versiyon)
-  * * Shell komutlarını çalıştırır, çıktılarını yakalar ve görüntüler.
-  * Özel komutlar (ps) için farklı işlemler yapar.
-  * * @param tab_index Komutun çalıştırılacağı sekme
-  * @param cmdline Çalıştırılacak komut
+  * @brief Belirteçlere ayrılmış komut satırı
+  * * argv, bayraklar ve belirteç metinleri tek bir arenada tutulur. Kısa satırlar
+  * için yapının içindeki alan kullanılır (hiç bellek ayrılmaz), uzun satırlar için
+  * satır uzunluğuna göre tek bir blok ayrılır; belirteç sayısı sınırsızdır.
   */
- void model_execute_command(int tab_index, const char *cmdline) {
-     model_add_to_history(cmdline);  // Geçmişe ekle
+ typedef struct {
+     char **argv;              // Belirteçler (NULL ile biter)
+     unsigned char *flags;     // Her belirtecin TOKEN_* bayrakları
+     int argc;                 // Belirteç sayısı
+     void *heap;               // Uzun satırlar için ayrılan arena (NULL = iç alan)
+     void *expanded;           // Joker genişletmesinden sonraki argv, bayraklar ve eşleşmeler (NULL = yok)
+     void *inline_arena[TOKEN_INLINE_WORDS];
+ } TokenList;
  
-     // "ps" özel komutu: çalışan süreçleri listele
-     if (strcmp(cmdline, "ps") == 0) {
-         char *process_list = get_process_list();
-         if (output_callback) {
-             // 'ps' komutunun çıktısını farklı bir renkle gösterebiliriz
-             output_callback(tab_index, process_list, "lightgreen"); 
-         }
-         return;
+ static void glob_expand(int tab_index, TokenList *list);
+ 
+ /**
+  * @brief Satırın başındaki işlecin uzunluğunu döndürür
+  * * "2>" gibi fd önekleri yalnızca belirtecin başında işlecin parçasıdır.
+  * * @param p Belirtecin başı
+  * @return size_t İşleç uzunluğu veya işleç değilse 0
+  */
+ static size_t operator_length(const char *p) {
+     const char *q = p;
+     if (*q == '|') return 1;
+     if (*q == '&' && q[1] != '>') return 1;
+     if (isdigit((unsigned char)*q) && (q[1] == '<' || q[1] == '>')) q++;
+     else if (*q == '&') q++; // &> ve &>>
+     if (*q == '<') return q + 1 - p;
+     if (*q != '>') return 0;
+     q++;
+     if (*q == '>') return q + 1 - p;
+     if (*q == '&' && *p != '&' && isdigit((unsigned char)q[1])) return q + 2 - p; // N>&M
+     return q - p;
+ }
+ 
+ /**
+  * @brief Metnin geçerli bir değişken adı olup olmadığını söyler ([A-Za-z_][A-Za-z0-9_]*)
+  */
+ static int is_var_name(const char *name, size_t len) {
+     if (len == 0 || (!isalpha((unsigned char)name[0]) && name[0] != '_')) return 0;
+     for (size_t i = 1; i < len; i++) {
+         if (!isalnum((unsigned char)name[i]) && name[i] != '_') return 0;
      }
-     
-     // Boş komutu çalıştırma
-     const char *p = cmdline;
-     while (*p && isspace((unsigned char)*p)) p++;
-     if (*p == '\0') return;
+     return 1;
+ }
+ 
+ /**
+  * @brief '$'dan sonraki değişken başvurusunu ("AD", "{AD}" veya "?") çözer
+  * * @param p '$'dan sonraki karakter
+  * @param name Adın başı yazılır
+  * @param name_len Adın uzunluğu yazılır
+  * @return size_t Başvurunun '$' hariç uzunluğu veya başvuru değilse 0
+  */
+ static size_t var_ref_length(const char *p, const char **name, size_t *name_len) {
+     int braced = (*p == '{');
+     const char *q = p + braced;
+     *name = q;
+     if (*q == '?') {
+         q++; // $?: son komutun çıkış kodu
+     } else {
+         if (!isalpha((unsigned char)*q) && *q != '_') return 0;
+         while (isalnum((unsigned char)*q) || *q == '_') q++;
+     }
+     *name_len = q - *name;
+     if (braced) {
+         if (*q != '}') return 0;
+         q++;
+     }
+     return q - p;
+ }
  
+ /**
+  * @brief Ters bölü kaçışlarını yerinde kaldırır ("\*" -> "*")
+  * * @return size_t Yeni uzunluk
+  */
+ static size_t unescape_in_place(char *text, size_t len) {
+     char *out = text;
+     for (size_t i = 0; i < len; i++) {
+         if (text[i] == '\\' && i + 1 < len) i++;
+         *out++ = text[i];
+     }
+     return out - text;
+ }
  
-     // Pipe oluştur (çıktıları yakalamak için)
-     int pipefd[2];
-     if (pipe(pipefd) == -1) {
-         perror("pipe failed");
-         if (output_callback) output_callback(tab_index, "[Hata: Pipe oluşturulamadı]\n", "red");
-         return;
+ /**
+  * @brief Tırnaklı veya kaçışlı bir karakteri sözcüğe yazar
+  * * Genişletme açıkken joker desenlerinde anlamı olan karakterler \ ile
+  * kaçışlanır; böylece "'*'.c" yalnızca "*.c" adlı dosyayla eşleşir. Kaçışlar
+  * token_push veya glob_expand tarafından kaldırılır.
+  */
+ static char* put_literal(char *out, char c, int glob, unsigned char *flags) {
+     if (glob && strchr("*?[]\\", c)) {
+         *out++ = '\\';
+         *flags |= TOKEN_ESCAPED;
      }
+     *out++ = c;
+     return out;
+ }
  
-     // Fork ile yeni process oluştur
-     pid_t pid = fork();
-     if (pid == -1) {
-         // Fork hatası
-         perror("fork failed");
-         close(pipefd[0]);
-         close(pipefd[1]);
-         if (output_callback) output_callback(tab_index, "[Hata: Süreç oluşturulamadı]\n", "red");
-         return;
-     } 
-     
-     if (pid == 0) {
-         // ------- Çocuk (Child) süreç -------
-         close(pipefd[0]);  // Okuma ucunu kapat
-         
-         // stdout ve stderr'i pipe'a yönlendir
-         if (dup2(pipefd[1], STDOUT_FILENO) == -1 || dup2(pipefd[1], STDERR_FILENO) == -1) {
-             perror("dup2 failed in child");
-             close(pipefd[1]);
-             exit(1); // Hata ile çık
-         }
-         close(pipefd[1]); // Yönlendirme sonrası artık gereksiz
+ /**
+  * @brief Biten sözcüğü listeye ekler
+  * * Joker içermeyen sözcüklerin kaçışları burada, içerenlerinki glob_expand'de kaldırılır.
+  * * @return char* Sonraki sözcüğün başlayacağı yer
+  */
+ static char* token_push(TokenList *list, char *start, char *out, unsigned char flags) {
+     if ((flags & TOKEN_ESCAPED) && !(flags & TOKEN_GLOB)) {
+         out = start + unescape_in_place(start, out - start);
+     }
+     *out++ = '\0';
+     list->flags[list->argc] = flags & ~TOKEN_ESCAPED;
+     list->argv[list->argc++] = start;
+     return out;
+ }
  
-         // --- DEĞİŞİKLİK BAŞLANGICI ---
-         // Komutu ayrıştır ve argv dizisi oluştur
-         char *my_argv[MAX_ARGS]; 
-         char *cmdline_copy_for_parsing = strdup(cmdline); // Kopyasını al
-         if (!cmdline_copy_for_parsing) {
-              perror("strdup failed in child");
-              exit(1);
+ /**
+  * @brief Komut satırını tek geçişte belirteçlere ayırır
+  * * Tek tırnak içi olduğu gibi alınır; çift tırnak içinde yalnızca \\, \", \$ ve
+  * \` kaçışları işlenir; tırnak dışında ters bölü sonraki karakteri sıradan
+  * karakter yapar. Tırnaksız boşluklar belirteçleri ayırır; tırnaksız |, &, <
+  * ve > ayrı işleç belirteçleri olur (TOKEN_OP). Tırnaklı veya kaçışlı hiçbir
+  * karakter işleç sayılmaz, böylece grep '|' veya echo "a > b" doğru çalışır.
+  * * tab_index geçerliyse tırnaksız ve çift tırnak içindeki $AD ve ${AD} sekmenin
+  * değişkenleriyle değiştirilir. Tırnaksız değerler boşluklarda ayrı sözcüklere
+  * bölünür (atamalarda bölünmez); boş çıkan tırnaksız sözcük atılır. Tırnaksız
+  * *, ? veya [...] içeren sözcükler glob_expand ile eşleşen yollara genişletilir.
+  * * Arena boyutu önceden bilinir: çıktı en fazla girdi artı satırdaki
+  * değişkenlerin değerlerinin iki katıdır (joker karakter kaçışları için); her
+  * belirteç için bir işaretçi, bir bayrak ve metniyle bir NUL.
+  * * @param line Ayrıştırılacak satır (değiştirilmez)
+  * @param tab_index Değişkenleri kullanılacak sekme (-1 = genişletme yapılmaz)
+  * @param list Sonuç; başarıdan sonra token_list_free ile bırakılmalıdır
+  * @param error Hata durumunda açıklama yazılır
+  * @return int Başarılıysa 0, kapanmamış tırnakta veya bellek yetmezse -1
+  */
+ static int tokenize(const char *line, int tab_index, TokenList *list, const char **error) {
+     size_t n = strlen(line);
+     const char *name;
+     size_t name_len, ref;
+     if (tab_index >= 0) {
+         // Değerler arenaya sığsın diye satırdaki tüm başvurular önceden toplanır
+         // (tek tırnak içindekiler de sayılır; üst sınır olması yeterli)
+         for (const char *d = strchr(line, '$'); d; d = strchr(d + 1, '$')) {
+             const char *value = var_ref_length(d + 1, &name, &name_len) ? var_lookup(tab_index, name, name_len) : NULL;
+             if (value) n += 2 * strlen(value);
+         }
+     }
+     size_t need = (n + 1) * sizeof(char *) + (n + 1) + 2 * n + 1;
+     char *arena = (char *)list->inline_arena;
+     list->heap = NULL;
+     if (need > sizeof(list->inline_arena)) {
+         arena = list->heap = malloc(need);
+         if (!arena) {
+             *error = "bellek yetersiz";
+             return -1;
          }
+     }
+     list->argv = (char **)arena;
+     list->flags = (unsigned char *)(arena + (n + 1) * sizeof(char *));
+     char *out = (char *)list->flags + n + 1;
+     list->argc = 0;
+     list->expanded = NULL;
  
-         int arg_count = parse_command(cmdline_copy_for_parsing, my_argv, MAX_ARGS);
+     int glob = tab_index >= 0;
+     int has_glob = 0;
+     const char *p = line;
+     for (;;) {
+         while (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r') p++;
+         if (*p == '\0') break;
  
-         if (arg_count <= 0) {
-              // parse_command zaten hata mesajı basmış olabilir veya boş komut.
-              fprintf(stderr, "Invalid or empty command for execution.\n");
-              free(cmdline_copy_for_parsing); // Kopyayı serbest bırak
-              exit(1); // Hata ile çık
+         char *start = out;
+         unsigned char flags = 0;
+         size_t oplen = operator_length(p);
+         if (oplen) {
+             memcpy(out, p, oplen);
+             out += oplen;
+             p += oplen;
+             flags = TOKEN_OP;
+         } else {
+             int plain = 1;  // Şimdiye dek yalnızca tırnaksız, kaçışsız karakterler mi
+             int quoted = 0; // Tırnak veya kaçış görüldü mü ("" boş argüman olarak kalır)
+             while (*p && !strchr(" \t\n\r|&<>", *p)) {
+                 if (*p == '$' && tab_index >= 0 && (ref = var_ref_length(p + 1, &name, &name_len))) {
+                     const char *value = var_lookup(tab_index, name, name_len);
+                     p += 1 + ref;
+                     plain = 0;
+                     for (; value && *value; value++) {
+                         if (flags & TOKEN_ASSIGN) {
+                             *out++ = *value;
+                         } else if (!strchr(" \t\n", *value)) {
+                             // Tırnaksız değerdeki jokerler de genişletilir
+                             if (strchr("*?[", *value)) flags |= TOKEN_GLOB;
+                             if (*value == '\\') out = put_literal(out, *value, glob, &flags);
+                             else *out++ = *value;
+                         } else if (out > start || quoted) {
+                             // Değerdeki boşluk sözcüğü bitirir, kalanı yeni sözcüktür
+                             has_glob |= flags & TOKEN_GLOB;
+                             out = token_push(list, start, out, flags);
+                             start = out;
+                             flags &= ~(TOKEN_GLOB | TOKEN_ESCAPED);
+                             quoted = 0;
+                         }
+                     }
+                 } else if (*p == '\'') {
+                     const char *close = strchr(p + 1, '\'');
+                     if (!close) goto unterminated;
+                     for (p++; p < close; p++) out = put_literal(out, *p, glob, &flags);
+                     p = close + 1;
+                     plain = 0;
+                     quoted = 1;
+                 } else if (*p == '"') {
+                     for (p++; *p != '"'; p++) {
+                         if (*p == '\0') goto unterminated;
+                         if (*p == '$' && tab_index >= 0 && (ref = var_ref_length(p + 1, &name, &name_len))) {
+                             const char *value = var_lookup(tab_index, name, name_len);
+                             for (; value && *value; value++) out = put_literal(out, *value, glob, &flags);
+                             p += ref; // Döngünün p++'ı başvurunun son karakterini geçer
+                             continue;
+                         }
+                         if (*p == '\\' && p[1] && strchr("\\\"$`", p[1])) p++;
+                         out = put_literal(out, *p, glob, &flags);
+                     }
+                     p++;
+                     plain = 0;
+                     quoted = 1;
+                 } else if (*p == '\\' && p[1]) {
+                     out = put_literal(out, p[1], glob, &flags);
+                     p += 2;
+                     plain = 0;
+                     quoted = 1;
+                 } else {
+                     if (*p == '=' && plain && !(flags & TOKEN_ASSIGN) && is_var_name(start, out - start)) {
+                         flags |= TOKEN_ASSIGN;
+                     }
+                     // '[' yalnızca sözcükte ardından ']' geliyorsa jokerdir ("[ -f x ]" komutu)
+                     if (glob && !(flags & TOKEN_ASSIGN) &&
+                         (*p == '*' || *p == '?' || (*p == '[' && memchr(p, ']', strcspn(p, " \t\n\r|&<>"))))) {
+                         flags |= TOKEN_GLOB;
+                     }
+                     *out++ = *p++;
+                 }
+             }
+             if (out == start && !quoted) continue; // Boş genişleme sözcük üretmez
          }
+         has_glob |= flags & TOKEN_GLOB;
+         out = token_push(list, start, out, flags);
+     }
+     list->argv[list->argc] = NULL;
+     if (has_glob) glob_expand(tab_index, list);
+     return 0;
  
-         // Komutu doğrudan çalıştır
-         execvp(my_argv[0], my_argv);
-         // --- DEĞİŞİKLİK SONU ---
+ unterminated:
+     *error = "kapanmamış tırnak";
+     free(list->heap);
+     list->heap = NULL;
+     return -1;
+ }
  
-         // Eğer buraya gelirse execvp başarısız olmuştur
-         // Hata mesajı execvp'nin kendisi tarafından stderr'e (pipe'a) yazılmış olmalı.
-         perror("execvp failed"); 
-         fprintf(stderr, "Command not found or execution failed: %s\n", my_argv[0]); // Ekstra bilgi
-         free(cmdline_copy_for_parsing); // execvp başarısız olursa kopyayı free et
-         exit(1); // Hata kodu ile çık
+ /**
+  * @brief tokenize'ın ayırdığı arenayı bırakır
+  */
+ static void token_list_free(TokenList *list) {
+     free(list->heap);
+     list->heap = NULL;
+     g_free(list->expanded);
+     list->expanded = NULL;
+ }
  
-     } else {
-         // ------- Ana (Parent) süreç -------
-         close(pipefd[1]);  // Yazma ucunu kapat
-         
-         // Process tablosuna ekle
-         add_process(pid, cmdline, tab_index);
- 
-         // Pipe'dan çıktıları oku ve görüntüle (Zaman aşımı ve limit kontrolü ile)
-         int status = 0; // waitpid için durum değişkeni
-         char buffer[256];
-         ssize_t n;
-         size_t total_bytes = 0;
-         const size_t max_bytes = 100000;  // Maksimum çıktı limiti
-         int child_exited = 0;             // Çocuk sürecin bitip bitmediğini takip et
- 
-         // select kullanarak hem pipe'ı dinle hem de zaman aşımı uygula
-         while (total_bytes < max_bytes) {
-             fd_set read_fds;
-             struct timeval timeout;
- 
-             FD_ZERO(&read_fds);
-             FD_SET(pipefd[0], &read_fds);
- 
-             // Timeout: Kısa aralıklarla kontrol et
-             timeout.tv_sec = 0;
-             timeout.tv_usec = 50000; // 50ms
- 
-             int ready = select(pipefd[0] + 1, &read_fds, NULL, NULL, &timeout);
- 
-             if (ready == -1) { // select hatası
-                  perror("select failed");
-                  break;
-             } else if (ready > 0) { // Pipe'dan okunacak veri var
-                 n = read(pipefd[0], buffer, sizeof(buffer) - 1);
-                 if (n > 0) { // Veri okundu
-                     buffer[n] = '\0';
-                     if (output_callback) {
-                          output_callback(tab_index, buffer, NULL); // Rengi Controller belirlesin
-                     }
-                     total_bytes += n;
-                 } else { // n <= 0: Pipe kapandı (çocuk süreç bitti veya hata)
-                     child_exited = 1;
-                     break; 
-                 }
-             } else { // ready == 0: Timeout, veri gelmedi
-                 // Çocuk sürecin bitip bitmediğini kontrol et (zombie olmasın)
-                 pid_t result = waitpid(pid, &status, WNOHANG);
-                 if (result == pid) { // Çocuk süreç bitmiş
-                      child_exited = 1;
-                      break;
-                 } else if (result == -1) { // waitpid hatası
-                      perror("waitpid error during poll");
-                      break;
+ /**
+  * @brief Metni, tokenize tek belirteç olarak geri okuyacak biçimde ekler
+  * * Özel karakter içermeyen metin olduğu gibi, diğerleri tek tırnak içinde
+  * eklenir (içteki tek tırnaklar '\'' olur).
+  * * @param out Hedef
+  * @param text Eklenecek metin
+  */
+ static void append_quoted(GString *out, const char *text) {
+     if (*text && !text[strcspn(text, " \t\n\r'\"\\|&<>$`*?[")]) {
+         g_string_append(out, text);
+         return;
+     }
+     g_string_append_c(out, '\'');
+     for (const char *p = text; *p; p++) {
+         if (*p == '\'') g_string_append(out, "'\\''");
+         else g_string_append_c(out, *p);
+     }
+     g_string_append_c(out, '\'');
+ }
+ 
+ // Komut listesi bağlaçları (list_next)
+ #define LIST_END 0 // Satır bitti
+ #define LIST_SEQ 1 // ";" veya "&": sonraki komut her durumda çalışır
+ #define LIST_AND 2 // "&&": sonraki komut yalnızca önceki başarılıysa çalışır
+ #define LIST_OR 3  // "||": sonraki komut yalnızca önceki başarısızsa çalışır
+ 
+ /**
+  * @brief "$(" veya '`' ile başlayan komut yerine koymanın kapanışını bulur
+  * * $(...) iç içe olabilir; içteki tırnaklar, kaçışlar ve parantezler atlanır.
+  * * @param p '$' veya '`' karakteri
+  * @return const char* Kapanış ')' veya '`' karakteri, kapanmamışsa NULL
+  */
+ static const char* subst_close(const char *p) {
+     if (*p == '`') {
+         for (p++; *p && *p != '`'; p++) {
+             if (*p == '\\' && p[1]) p++;
+         }
+         return *p ? p : NULL;
+     }
+     int depth = 0;
+     for (p += 2; *p; p++) {
+         if (*p == '\\' && p[1]) {
+             p++;
+         } else if (*p == '\'') {
+             p = strchr(p + 1, '\'');
+             if (!p) return NULL;
+         } else if (*p == '"') {
+             for (p++; *p && *p != '"'; p++) {
+                 if (*p == '\\' && p[1]) p++;
+                 else if ((*p == '$' && p[1] == '(') || *p == '`') {
+                     if (!(p = subst_close(p))) return NULL;
                  }
-                 // Çocuk hala çalışıyor, döngüye devam
              }
-         } // while döngüsü sonu
+             if (!*p) return NULL;
+         } else if ((*p == '$' && p[1] == '(') || *p == '`') {
+             if (!(p = subst_close(p))) return NULL;
+         } else if (*p == '(') {
+             depth++;
+         } else if (*p == ')') {
+             if (depth == 0) return p;
+             depth--;
+         }
+     }
+     return NULL;
+ }
  
-         // Döngüden çıkıldıktan sonra kontroller
-         if (total_bytes >= max_bytes) {
-             if (output_callback) {
-                 output_callback(tab_index, "\n[Çıktı limiti aşıldı, kesildi...]\n", "orange");
+ /**
+  * @brief Komut listesindeki bir sonraki komutun sonunu bulur
+  * * Tırnak ve kaçışlar tokenize'daki gibi atlanır. Tek '&' komutu arka plana
+  * gönderir ve komuta dahil edilir ("a & b" -> "a &", "b"); "2>&1", "&>" ve
+  * ">&" yönlendirmelerdeki '&' bağlaç sayılmaz. $(...) ve `...` içi atlanır.
+  * * @param p Komutun başı
+  * @param end Komutun sonu (bağlaç hariç) yazılır
+  * @param next Bağlaçtan sonraki konum yazılır
+  * @return int Komutu bitiren bağlaç (LIST_*)
+  */
+ static int list_next(const char *p, const char **end, const char **next) {
+     const char *start = p;
+     for (; *p; p++) {
+         if (*p == '\\' && p[1]) {
+             p++;
+         } else if (*p == '\'') {
+             const char *close = strchr(p + 1, '\'');
+             if (!close) break; // Kapanmamış tırnağı tokenize bildirir
+             p = close;
+         } else if (*p == '"') {
+             for (p++; *p && *p != '"'; p++) {
+                 if (*p == '\\' && p[1]) p++;
+                 else if (((*p == '$' && p[1] == '(') || *p == '`') && !(p = subst_close(p))) break;
              }
-             // Limit aşıldıysa süreci sonlandır
-             kill(pid, SIGKILL); 
-             waitpid(pid, &status, 0); // Zombie olmasını bekle
-             update_process_status(pid, 2); // killed
-             child_exited = 1; // Artık bitmiş sayılır
-         }
-         
-         // Eğer çocuk süreç döngü içinde bitmediyse, burada bekle
-         if (!child_exited) {
-              if (waitpid(pid, &status, 0) == pid) { // Başarıyla bitti
-                  update_process_status(pid, 1); // completed
-              } else { // Beklerken hata oluştu veya sinyal aldı
-                  // Durumu kontrol et, belki zorla sonlandırıldı
-                  if (!find_process(pid) || find_process(pid)->status == 0) {
-                      // Eğer hala running görünüyorsa ve bekleme başarısızsa, killed sayılabilir
-                      update_process_status(pid, 2); // veya başka bir hata durumu
-                  }
-              }
-         } else {
-              // Döngü içinde zaten bittiği tespit edildiyse, durumunu güncelle
-              if (find_process(pid) && find_process(pid)->status == 0) { // Hala running görünüyorsa
-                  update_process_status(pid, 1); // completed
-              }
+             if (!p || !*p) break;
+         } else if ((*p == '$' && p[1] == '(') || *p == '`') {
+             if (!(p = subst_close(p))) break; // Kapanmamışsa komut yerine koyma bildirir
+         } else if (*p == ';') {
+             *end = p;
+             *next = p + 1;
+             return LIST_SEQ;
+         } else if (*p == '|' && p[1] == '|') {
+             *end = p;
+             *next = p + 2;
+             return LIST_OR;
+         } else if (*p == '&' && p[1] == '&') {
+             *end = p;
+             *next = p + 2;
+             return LIST_AND;
+         } else if (*p == '&' && p[1] != '>' && (p == start || p[-1] != '>')) {
+             *end = p + 1;
+             *next = p + 1;
+             return LIST_SEQ;
          }
+     }
+     *end = start + strlen(start);
+     *next = *end;
+     return LIST_END;
+ }
+ 
+ // ------------------- YENİ EKLENEN KISIM SONU ---------------------
+ 
+ 
+ #define MAX_PIPELINE 16  // Bir boru hattındaki (a | b | c) maksimum aşama sayısı
+ 
+ /**
+  * @brief Çalışmakta olan bir komutun (işin) durumunu tutan veri yapısı
+  *
+  * Bir iş, tek bir süreç grubundaki bir veya daha fazla boru hattı aşamasından
+  * oluşur. Aşamalar arası veri doğrudan çocuklar arasındaki pipe'lardan akar;
+  * yalnızca son aşamanın stdout'u ile tüm aşamaların stderr'i çıktı pipe'ına
+  * bağlanır (sekme PTY kipindeyse pipe yerine sözde terminal). Çıktı ucu GTK
+  * ana döngüsüne g_unix_fd_add ile bağlanır; süreçlerin sonu launcher tarafından
+  * bildirilir. Çıktı kapanıp tüm süreçler toplandığında yapı serbest bırakılır.
+  * Sekmede ilk MAX_OUTPUT_BYTES bayt canlı gösterilir ve bellekte tutulur.
+  * Çıktı bu pencereyi aşarsa diskte bir yakalama dosyası açılır, bellekteki
+  * baş kısım oraya yazılır ve devamı dosyaya aktarılır; son
+  * OUTPUT_TAIL_BYTES bayt iş bitince gösterilir.
+  */
+ typedef struct {
+     pid_t pgid;               // İşin süreç grubu (ilk başlatılan aşama)
+     pid_t last_pid;           // Son aşamanın PID'i (-1 = başlatılamadı)
+     int last_status;          // Son aşamanın waitpid durumu (işin durumu)
+     int running;              // Henüz toplanmamış süreç sayısı
+     int tab_index;            // Çıktının yazılacağı sekme
+     int out_fd;               // Pipe'ın okuma ucu (-1 = kapalı)
+     guint out_watch;          // Pipe için ana döngü kaynağı (0 = kapalı)
+     size_t total_bytes;       // Şimdiye kadar okunan toplam bayt
+     GString *head;            // Pencereye sığan çıktı (dosya açılınca ona yazılır ve bırakılır)
+     int capture_fd;           // Çıktının tamamının yazıldığı dosya (-1 = yok / henüz açılmadı)
+     int capture_error;        // Yakalama dosyasına yazılamadıysa errno
+     int overflowed;           // Çıktı sekme penceresini aştı mı
+     int no_splice;            // Çıktı ucu splice desteklemiyor (PTY)
+     int out_mode;             // OUT_MODE_PIPE veya OUT_MODE_PTY
+     gint64 start_us;          // Başlatma anı (ilk bayt süresini ölçmek için)
+     int got_output;           // İlk bayt geldi mi
+     int id;                   // Sekme içindeki iş numarası (%n)
+     int background;           // Arka planda mı ('&', bg veya durdurulduktan sonra)
+     int stopped;              // SIGSTOP/SIGTSTP ile durduruldu mu
+     pid_t pids[MAX_PIPELINE]; // Başlatılan aşamaların PID'leri
+     ProcessRef procs[MAX_PIPELINE]; // Aşamaların process tablosundaki kayıtları
+     int npids;
+     char command[256];        // "jobs" çıktısı için komut satırı
+     struct ParallelRun *parallel; // "parallel" girdisiyse ait olduğu çalıştırma (iş tablosunda yer almaz)
+     int parallel_item;        // Çalıştırmadaki girdi sırası
+     gint64 end_us;            // Son sürecin toplandığı an
+     GString *line_buf;        // Önek eklenmeyi bekleyen yarım satır
+     int timed;                // "time" ile başlatıldı mı (bitince özet yazılır)
+     guint64 user_us;          // Aşamaların toplam kullanıcı CPU süresi
+     guint64 sys_us;           // Aşamaların toplam çekirdek CPU süresi
+     long max_rss_kb;          // Aşamalar içindeki en yüksek yerleşik bellek
+     long major_faults;        // Aşamaların toplam büyük sayfa hatası
+     gint64 deadline_us;       // Duvar saati sınırının dolacağı an (0 = yok)
+     int timeout_stage;        // Süre dolduktan sonra: 1 = SIGTERM gönderildi
+     struct Substitution *subst; // $(...) işiyse stdout'un toplandığı yer (NULL = değil)
+     int err_fd;               // Komut yerine koymada ayrı stderr pipe'ı (-1 = yok)
+     guint err_watch;          // stderr pipe'ı için ana döngü kaynağı
+ } Job;
+ 
+ /**
+  * @brief "parallel" komutunun bir çalıştırması
+  *
+  * Aynı komut şablonu her girdi için ayrı bir iş olarak (kendi süreç grubunda)
+  * çalıştırılır; aynı anda en fazla max_workers iş çalışır. Biten her işin yerine
+  * sıradaki girdi başlatılır.
+  */
+ typedef struct ParallelRun {
+     int tab_index;            // Çıktının yazılacağı sekme
+     char *template;           // Komut şablonu ("{}" girdiyle değiştirilir)
+     GPtrArray *args;          // Girdiler
+     guint next;               // Başlatılacak sıradaki girdi
+     int max_workers;          // Aynı anda çalışacak en fazla iş
+     Job **workers;            // Çalışan işler (max_workers yuvalı)
+     int running;              // Çalışan iş sayısı
+     int failed;               // Sıfır olmayan çıkış koduyla biten iş sayısı
+     int background;           // '&' ile başlatıldı mı
+     gint64 start_us;          // Başlangıç anı (toplam süre için)
+     gint64 job_total_us;      // İş sürelerinin toplamı
+     gint64 job_min_us;        // En kısa iş
+     gint64 job_max_us;        // En uzun iş
+     guint finished;           // Biten iş sayısı
+ } ParallelRun;
+ 
+ #define MAX_OUTPUT_BYTES 100000   // Sekmede canlı gösterilecek en fazla çıktı (fazlası yalnızca dosyaya yazılır)
+ #define OUTPUT_TAIL_BYTES 100000  // Pencereyi aşan çıktının iş bitince gösterilen sonu
+ #define OUTPUT_READ_BUDGET 65536  // Tek olayda okunacak en fazla bayt (diğer sekmeler beklemesin)
+ #define SPILL_BUDGET (4 << 20)    // Pencere dolduktan sonra tek olayda dosyaya aktarılacak en fazla bayt
+ #define SPILL_CHUNK (1 << 20)     // Tek splice çağrısında aktarılacak en fazla bayt
+ 
+ // Her sekmede en son tamamlanan işin çıkış kodu
+ static int tab_last_status[MAX_TABS];
+ 
+ // İş tablosu: her sekmenin henüz bitmemiş işleri, iş numarası -> Job ("parallel"
+ // girdileri hariç). İşler sekme ve numarayla doğrudan bulunur; hiçbir işlem
+ // tüm sekmelerin işlerini taramaz.
+ static GHashTable *tab_jobs[MAX_TABS];
+ static int tab_next_job_id[MAX_TABS]; // Sekmedeki en büyük iş numarasının bir fazlası
+ 
+ // Her sekmenin ön plandaki işi (NULL = yok). Ön planda iş varken ya da "wait"
+ // beklerken girilen komutlar sıraya alınır ve iş bitince sırayla çalıştırılır.
+ static Job *tab_fg_job[MAX_TABS];
+ static int tab_wait_id[MAX_TABS];     // "wait": 0 = beklemiyor, -1 = tüm arka plan işleri, >0 = %n
+ static GQueue tab_pending[MAX_TABS];  // Sekme meşgulken girilen komutlar
+ static char *tab_sequence[MAX_TABS];  // Ön plandaki iş bitince sürdürülecek komut listesinin kalanı
+ static int tab_sequence_op[MAX_TABS]; // Kalanın başındaki bağlaç (LIST_*)
+ static ParallelRun *tab_fg_parallel[MAX_TABS]; // Sekmenin ön plandaki "parallel" çalıştırması
+ static GList *parallel_runs = NULL;   // Süren tüm "parallel" çalıştırmaları (arka plandakiler dahil)
+ 
+ // Çıktı yakalama kipi: düz pipe veya sözde terminal (PTY)
+ #define OUT_MODE_PIPE 0
+ #define OUT_MODE_PTY 1
+ static const char *const out_mode_names[] = { "pipe", "pty" };
+ 
+ // Her sekmenin çıktı kipi (varsayılan pipe)
+ static int tab_out_mode[MAX_TABS];
  
-         close(pipefd[0]); // Okuma ucunu kapat
-     } // Ana süreç sonu
- }
\ No newline at end of file
+ /**
+  * @brief Kip başına ilk bayt süresi (time-to-first-byte) istatistikleri
+  */
+ typedef struct {
+     unsigned long count;  // Ölçüm sayısı
+     gint64 last_us;       // Son ölçüm
+     gint64 min_us;        // En kısa
+     gint64 max_us;        // En uzun
+     gint64 total_us;      // Ortalama için toplam
+ } FirstByteStats;
+ 
+ static FirstByteStats first_byte_stats[2];
+ 
+ /**
+  * @brief Yerleşik komutun hatasını yazar ve sekmenin çıkış kodunu 1 yapar ("cd x && ..." için)
+  */
+ static void command_error(int tab_index, const char *msg) {
+     if (output_callback) output_callback(tab_index, msg, "red");
+     if (tab_index >= 0 && tab_index < MAX_TABS) tab_last_status[tab_index] = 1;
+ }
+ 
+ // ------------------- Çalışma dizinleri -------------------
+ 
+ /**
+  * @brief Bir sekmenin çalışma dizini
+  * * Dizin O_PATH fd olarak tutulur ve çocuklara launcher üzerinden fchdir ile
+  * uygulanır; sürecin kendi cwd'si hiç değişmez. Böylece sekmeler birbirinin
+  * dizinini bozmadan aynı anda komut çalıştırabilir.
+  */
+ typedef struct {
+     int fd;                   // O_PATH|O_DIRECTORY fd (-1 = açılmadı)
+     char *path;               // Gösterim için mutlak yol (NULL = henüz açılmadı)
+ } TabDir;
+ 
+ static TabDir tab_cwd[MAX_TABS];
+ static TabDir tab_oldpwd[MAX_TABS];    // "cd -" için önceki dizin
+ static GQueue tab_dirstack[MAX_TABS];  // "pushd" ile saklanan dizinler (TabDir*)
+ 
+ /**
+  * @brief Dizini açar ve mutlak yolunu bulur
+  * * Göreli yollar base dizinine göre, "~" ve "~/..." ev dizinine göre çözülür.
+  * * @param base Göreli yolların çözüleceği dizin fd'si (veya AT_FDCWD)
+  * @param path Açılacak dizin
+  * @param out Sonuç (başarılıysa fd ve path doldurulur)
+  * @return int Başarılıysa 0, hata durumunda -1 (errno ayarlı)
+  */
+ static int tab_dir_open(int base, const char *path, TabDir *out) {
+     char *expanded = NULL;
+     if (path[0] == '~' && (path[1] == '\0' || path[1] == '/')) {
+         expanded = g_strconcat(g_get_home_dir(), path + 1, NULL);
+         path = expanded;
+     }
+     int fd = openat(base, path, O_PATH | O_DIRECTORY | O_CLOEXEC);
+     if (fd == -1) {
+         int saved = errno;
+         g_free(expanded);
+         errno = saved;
+         return -1;
+     }
+ 
+     // Gerçek yolu çekirdekten al (sembolik bağlar ve ".." çözülmüş olur)
+     char proc_path[64], real[PATH_MAX];
+     snprintf(proc_path, sizeof(proc_path), "/proc/self/fd/%d", fd);
+     ssize_t n = readlink(proc_path, real, sizeof(real) - 1);
+     if (n > 0) {
+         real[n] = '\0';
+         out->path = g_strdup(real);
+     } else {
+         out->path = g_strdup(path);
+     }
+     out->fd = fd;
+     g_free(expanded);
+     return 0;
+ }
+ 
+ /**
+  * @brief TabDir'in kaynaklarını bırakır
+  */
+ static void tab_dir_clear(TabDir *dir) {
+     if (dir->path && dir->fd != -1) close(dir->fd);
+     g_free(dir->path);
+     dir->fd = -1;
+     dir->path = NULL;
+ }
+ 
+ /**
+  * @brief Sekmenin çalışma dizinini döndürür (ilk çağrıda sürecin cwd'si açılır)
+  * * @param tab_index Sekme
+  * @return const TabDir* Dizin veya açılamadıysa NULL
+  */
+ static const TabDir* tab_dir_get(int tab_index) {
+     if (tab_index < 0 || tab_index >= MAX_TABS) return NULL;
+     TabDir *dir = &tab_cwd[tab_index];
+     if (!dir->path && tab_dir_open(AT_FDCWD, ".", dir) == -1) return NULL;
+     return dir;
+ }
+ 
+ /**
+  * @brief Sekmenin dizin fd'sini döndürür (çocuklara verilecek, -1 = miras al)
+  */
+ static int tab_dir_fd(int tab_index) {
+     const TabDir *dir = tab_dir_get(tab_index);
+     return dir ? dir->fd : -1;
+ }
+ 
+ /**
+  * @brief Sekmenin dizinine göre dosya açarken kullanılacak fd'yi döndürür (*at çağrıları için)
+  */
+ static int tab_dir_at(int tab_index) {
+     int fd = tab_dir_fd(tab_index);
+     return fd != -1 ? fd : AT_FDCWD;
+ }
+ 
+ /**
+  * @brief Sekmenin dizinini değiştirir; eski dizin "cd -" için saklanır
+  * * @param tab_index Sekme
+  * @param dir Yeni dizin (sahipliği sekmeye geçer)
+  */
+ static void tab_dir_set(int tab_index, TabDir dir) {
+     tab_dir_clear(&tab_oldpwd[tab_index]);
+     tab_oldpwd[tab_index] = tab_cwd[tab_index];
+     tab_cwd[tab_index] = dir;
+     if (cwd_callback) cwd_callback(tab_index, dir.path);
+ }
+ 
+ /**
+  * @brief Sekmenin dizinini ve pushd yığınını "dirs" biçiminde yazar
+  */
+ static void show_dirs(int tab_index) {
+     const TabDir *cwd = tab_dir_get(tab_index);
+     GString *out = g_string_new(cwd ? cwd->path : "?");
+     for (GList *l = tab_dirstack[tab_index].head; l; l = l->next) {
+         g_string_append_c(out, ' ');
+         g_string_append(out, ((TabDir *)l->data)->path);
+     }
+     g_string_append_c(out, '\n');
+     if (output_callback) output_callback(tab_index, out->str, "lightgreen");
+     g_string_free(out, TRUE);
+ }
+ 
+ /**
+  * @brief Dizin komutlarının hata mesajını yazar
+  */
+ static void dir_error(int tab_index, const char *cmd, const char *path, int err) {
+     char msg[PATH_MAX + 64];
+     snprintf(msg, sizeof(msg), "%s: %s: %s\n", cmd, path, strerror(err));
+     command_error(tab_index, msg);
+ }
+ 
+ /**
+  * @brief Dizin komutunun argümanını genişletip ilk sözcüğü döndürür ("cd $HOME", "cd 'a b'")
+  * * @param tokens Sonuç; dönen değer bunun içinde durur, token_list_free ile bırakılmalıdır
+  * @return const char* İlk sözcük, argüman yoksa "" veya hata olursa NULL (bildirilmiş olarak)
+  */
+ static const char* dir_argument(int tab_index, const char *cmd, const char *args, TokenList *tokens) {
+     const char *error;
+     if (tokenize(args, tab_index, tokens, &error) == -1) {
+         char msg[320];
+         snprintf(msg, sizeof(msg), "%s: %s\n", cmd, error);
+         command_error(tab_index, msg);
+         return NULL;
+     }
+     return tokens->argc ? tokens->argv[0] : "";
+ }
+ 
+ /**
+  * @brief Sekmenin çalışma dizinini değiştiren "cd" komutu
+  * * "cd" ev dizinine, "cd -" önceki dizine döner (ve yeni dizini yazar).
+  * Yalnızca bu sekmenin dizini değişir.
+  * * @param tab_index Komutun çalıştırıldığı sekme
+  * @param args Komut adından sonraki kısım
+  */
+ static void change_dir(int tab_index, const char *args) {
+     if (tab_index < 0 || tab_index >= MAX_TABS) return;
+     TokenList tokens;
+     const char *target = dir_argument(tab_index, "cd", args, &tokens);
+     if (!target) return;
+     if (*target == '\0') {
+         const char *home = var_lookup(tab_index, "HOME", 4);
+         target = home && *home ? home : g_get_home_dir();
+     }
+     int show = 0;
+     if (strcmp(target, "-") == 0) {
+         if (!tab_oldpwd[tab_index].path) {
+             command_error(tab_index, "cd: önceki dizin yok\n");
+             token_list_free(&tokens);
+             return;
+         }
+         target = tab_oldpwd[tab_index].path; // Yeniden açılır: silinmişse fark edilir
+         show = 1;
+     }
+ 
+     TabDir dir;
+     if (tab_dir_open(tab_dir_at(tab_index), target, &dir) == -1) {
+         dir_error(tab_index, "cd", target, errno);
+     } else {
+         tab_dir_set(tab_index, dir);
+         if (show) show_dirs(tab_index);
+     }
+     token_list_free(&tokens);
+ }
+ 
+ /**
+  * @brief "pushd" komutu: geçerli dizini yığına saklayıp yeni dizine geçer
+  * * Argümansız "pushd" geçerli dizinle yığının tepesini değiştirir.
+  * * @param tab_index Komutun çalıştırıldığı sekme
+  * @param args Komut adından sonraki kısım
+  */
+ static void push_dir(int tab_index, const char *args) {
+     const TabDir *cwd = tab_dir_get(tab_index);
+     if (!cwd) return;
+     TokenList tokens;
+     const char *target = dir_argument(tab_index, "pushd", args, &tokens);
+     if (!target) return;
+ 
+     TabDir dir;
+     int failed = 0;
+     if (*target == '\0') {
+         TabDir *top = g_queue_pop_head(&tab_dirstack[tab_index]);
+         if (top) {
+             dir = *top;
+             g_free(top);
+         } else {
+             command_error(tab_index, "pushd: başka dizin yok\n");
+             failed = 1;
+         }
+     } else if (tab_dir_open(cwd->fd, target, &dir) == -1) {
+         dir_error(tab_index, "pushd", target, errno);
+         failed = 1;
+     }
+     token_list_free(&tokens);
+     if (failed) return;
+ 
+     // Geçerli dizin hem yığına hem "cd -" için saklanır; yığına kopyası konur
+     TabDir *saved = g_new(TabDir, 1);
+     saved->fd = fcntl(cwd->fd, F_DUPFD_CLOEXEC, 0);
+     saved->path = g_strdup(cwd->path);
+     g_queue_push_head(&tab_dirstack[tab_index], saved);
+     tab_dir_set(tab_index, dir);
+     show_dirs(tab_index);
+ }
+ 
+ /**
+  * @brief "popd" komutu: yığının tepesindeki dizine döner
+  * * @param tab_index Komutun çalıştırıldığı sekme
+  */
+ static void pop_dir(int tab_index) {
+     if (tab_index < 0 || tab_index >= MAX_TABS) return;
+     TabDir *top = g_queue_pop_head(&tab_dirstack[tab_index]);
+     if (!top) {
+         command_error(tab_index, "popd: dizin yığını boş\n");
+         return;
+     }
+     tab_dir_set(tab_index, *top);
+     g_free(top);
+     show_dirs(tab_index);
+ }
+ 
+ /**
+  * @brief Sekmenin çalışma dizinini döndürür (sekme başlığı için)
+  * * @param tab_index Sekme
+  * @return const char* Mutlak yol veya NULL
+  */
+ const char* model_get_cwd(int tab_index) {
+     const TabDir *dir = tab_dir_get(tab_index);
+     return dir ? dir->path : NULL;
+ }
+ 
+ // ------------------- Değişkenler -------------------
+ 
+ /**
+  * @brief Kabuk değişkeni
+  */
+ typedef struct {
+     char *value;              // Değer (NULL = "export AD" ile bildirilmiş ama atanmamış)
+     int exported;             // Çocukların ortamına girer mi
+ } ShellVar;
+ 
+ /**
+  * @brief Bir sekmenin değişkenleri ve çocuklara verilen ortam
+  * * Sekme ilk kullanıldığında GUI'nin environ'undan (tümü dışa aktarılmış olarak)
+  * doldurulur. envp yalnızca dışa aktarılan bir değişken değiştiğinde yeniden
+  * kurulur ve her kurulumda yeni bir env_id alır; launcher aynı kimlikli ortamı
+  * yardımcıya bir kez gönderdiği için başlatma maliyeti ortamın boyutundan
+  * bağımsız kalır.
+  */
+ typedef struct {
+     GHashTable *vars;         // Ad -> ShellVar
+     char **envp;              // "AD=değer" dizisi, dizelerle tek blokta (NULL = kurulmalı)
+     guint64 env_id;           // envp'nin kimliği
+ } TabVars;
+ 
+ static TabVars tab_vars[MAX_TABS];
+ static guint64 next_env_id = 1;
+ 
+ /**
+  * @brief ShellVar'ı serbest bırakır (GHashTable değer yok edicisi)
+  */
+ static void shell_var_free(gpointer data) {
+     ShellVar *var = data;
+     g_free(var->value);
+     g_free(var);
+ }
+ 
+ /**
+  * @brief Sekmenin değişkenlerini döndürür (ilk çağrıda environ'dan doldurur)
+  * * @return TabVars* Geçersiz sekme için NULL
+  */
+ static TabVars* tab_vars_get(int tab_index) {
+     if (tab_index < 0 || tab_index >= MAX_TABS) return NULL;
+     TabVars *tv = &tab_vars[tab_index];
+     if (!tv->vars) {
+         tv->vars = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, shell_var_free);
+         for (char **e = environ; *e; e++) {
+             const char *eq = strchr(*e, '=');
+             if (!eq) continue;
+             ShellVar *var = g_new(ShellVar, 1);
+             var->value = g_strdup(eq + 1);
+             var->exported = 1;
+             g_hash_table_replace(tv->vars, g_strndup(*e, eq - *e), var);
+         }
+     }
+     return tv;
+ }
+ 
+ /**
+  * @brief Değişkenin değerini döndürür
+  * * @param tab_index Sekme (geçersizse GUI'nin ortamına bakılır)
+  * @param name Ad (NUL ile bitmesi gerekmez)
+  * @param len Adın uzunluğu
+  * @return const char* Değer veya atanmamışsa NULL
+  */
+ static const char* var_lookup(int tab_index, const char *name, size_t len) {
+     char key[256];
+     if (len == 1 && name[0] == '?') {
+         static char status[16]; // Bir sonraki çağrıya kadar geçerli
+         snprintf(status, sizeof(status), "%d", tab_index >= 0 && tab_index < MAX_TABS ? tab_last_status[tab_index] : 0);
+         return status;
+     }
+     if (len >= sizeof(key)) return NULL;
+     memcpy(key, name, len);
+     key[len] = '\0';
+     TabVars *tv = tab_vars_get(tab_index);
+     if (!tv) return getenv(key);
+     ShellVar *var = g_hash_table_lookup(tv->vars, key);
+     return var ? var->value : NULL;
+ }
+ 
+ /**
+  * @brief Değişkeni atar ve gerekiyorsa ortamı geçersiz kılar
+  * * @param tab_index Sekme
+  * @param name Ad
+  * @param value Değer (NULL = değeri değiştirme)
+  * @param export 1 ise dışa aktarılır; 0 ise mevcut durumu korunur
+  */
+ static void var_set(int tab_index, const char *name, const char *value, int export) {
+     TabVars *tv = tab_vars_get(tab_index);
+     if (!tv) return;
+     ShellVar *var = g_hash_table_lookup(tv->vars, name);
+     if (!var) {
+         var = g_new0(ShellVar, 1);
+         g_hash_table_replace(tv->vars, g_strdup(name), var);
+     }
+     if (value) {
+         g_free(var->value);
+         var->value = g_strdup(value);
+     }
+     if (export) var->exported = 1;
+     if (var->exported) {
+         g_free(tv->envp);
+         tv->envp = NULL;
+     }
+ }
+ 
+ /**
+  * @brief Değişkeni siler
+  */
+ static void var_unset(int tab_index, const char *name) {
+     TabVars *tv = tab_vars_get(tab_index);
+     ShellVar *var = tv ? g_hash_table_lookup(tv->vars, name) : NULL;
+     if (!var) return;
+     if (var->exported) {
+         g_free(tv->envp);
+         tv->envp = NULL;
+     }
+     g_hash_table_remove(tv->vars, name);
+ }
+ 
+ /**
+  * @brief Sekmenin çocuklara verilecek ortamını döndürür
+  * * Ortam yalnızca son değişiklikten sonraki ilk çağrıda kurulur.
+  * * @param tab_index Sekme
+  * @param env_id Ortamın kimliği yazılır (0 = GUI'nin environ'u)
+  * @return char* const* NULL ile biten "AD=değer" dizisi veya geçersiz sekmede NULL
+  */
+ static char* const* tab_env(int tab_index, guint64 *env_id) {
+     TabVars *tv = tab_vars_get(tab_index);
+     *env_id = 0;
+     if (!tv) return NULL;
+     if (!tv->envp) {
+         GHashTableIter it;
+         gpointer key, value;
+         size_t count = 0, size = 0;
+         g_hash_table_iter_init(&it, tv->vars);
+         while (g_hash_table_iter_next(&it, &key, &value)) {
+             ShellVar *var = value;
+             if (!var->exported || !var->value) continue;
+             count++;
+             size += strlen(key) + strlen(var->value) + 2;
+         }
+ 
+         char **envp = g_malloc((count + 1) * sizeof(char *) + size);
+         char *text = (char *)(envp + count + 1);
+         size_t i = 0;
+         g_hash_table_iter_init(&it, tv->vars);
+         while (g_hash_table_iter_next(&it, &key, &value)) {
+             ShellVar *var = value;
+             if (!var->exported || !var->value) continue;
+             envp[i++] = text;
+             text += sprintf(text, "%s=%s", (const char *)key, var->value) + 1;
+         }
+         envp[i] = NULL;
+         tv->envp = envp;
+         tv->env_id = next_env_id++;
+     }
+     *env_id = tv->env_id;
+     return tv->envp;
+ }
+ 
+ /**
+  * @brief Sekmenin ortamına "AD=değer" atamalarını ekleyerek tek seferlik bir ortam kurar
+  * * "AD=değer komut" biçimi için kullanılır; atamalar aynı adlı değişkenlerin
+  * yerine geçer. Dizeler kopyalanmaz.
+  * * @param tab_index Sekme
+  * @param assigns Atama belirteçleri
+  * @param nassigns Atama sayısı
+  * @return char** g_free ile bırakılacak dizi
+  */
+ static char** env_with_assignments(int tab_index, char *const *assigns, int nassigns) {
+     guint64 env_id;
+     char *const *base = tab_env(tab_index, &env_id);
+     if (!base) base = environ;
+     size_t count = 0;
+     while (base[count]) count++;
+ 
+     char **envp = g_new(char *, count + nassigns + 1);
+     size_t n = 0;
+     for (size_t i = 0; i < count; i++) {
+         size_t name_len = strcspn(base[i], "=");
+         int overridden = 0;
+         for (int k = 0; k < nassigns && !overridden; k++) {
+             overridden = strncmp(assigns[k], base[i], name_len + 1) == 0;
+         }
+         if (!overridden) envp[n++] = base[i];
+     }
+     for (int k = 0; k < nassigns; k++) envp[n++] = assigns[k];
+     envp[n] = NULL;
+     return envp;
+ }
+ 
+ /**
+  * @brief İki dize işaretçisini karşılaştırır (qsort için)
+  */
+ static int compare_strings(const void *a, const void *b) {
+     return strcmp(*(const char *const *)a, *(const char *const *)b);
+ }
+ 
+ /**
+  * @brief Dışa aktarılmış değişkenleri ada göre sıralı, yeniden girilebilir biçimde yazar
+  */
+ static void show_exports(int tab_index) {
+     TabVars *tv = tab_vars_get(tab_index);
+     if (!tv) return;
+     const char **names = g_new(const char *, g_hash_table_size(tv->vars) + 1);
+     size_t count = 0;
+     GHashTableIter it;
+     gpointer key, value;
+     g_hash_table_iter_init(&it, tv->vars);
+     while (g_hash_table_iter_next(&it, &key, &value)) {
+         if (((ShellVar *)value)->exported) names[count++] = key;
+     }
+     qsort(names, count, sizeof(*names), compare_strings);
+ 
+     GString *out = g_string_new(NULL);
+     for (size_t i = 0; i < count; i++) {
+         ShellVar *var = g_hash_table_lookup(tv->vars, names[i]);
+         g_string_append_printf(out, "export %s", names[i]);
+         if (var->value) {
+             g_string_append_c(out, '=');
+             append_quoted(out, var->value);
+         }
+         g_string_append_c(out, '\n');
+     }
+     if (output_callback && out->len) output_callback(tab_index, out->str, NULL);
+     g_string_free(out, TRUE);
+     g_free(names);
+ }
+ 
+ /**
+  * @brief "export [AD[=değer] ...]" ve "unset AD ..." komutları
+  * * Argümansız export dışa aktarılmış değişkenleri listeler.
+  * * @param tab_index Komutun çalıştırıldığı sekme
+  * @param unset 1 ise unset, 0 ise export
+  * @param args Komut adından sonraki kısım
+  */
+ static void var_command(int tab_index, int unset, const char *args) {
+     const char *cmd = unset ? "unset" : "export";
+     TokenList tokens;
+     const char *error;
+     char msg[320];
+     if (tokenize(args, tab_index, &tokens, &error) == -1) {
+         snprintf(msg, sizeof(msg), "%s: %s\n", cmd, error);
+         if (output_callback) output_callback(tab_index, msg, "red");
+         return;
+     }
+     if (tokens.argc == 0 && !unset) show_exports(tab_index);
+ 
+     int status = 0;
+     for (int i = 0; i < tokens.argc; i++) {
+         char *arg = tokens.argv[i];
+         char *eq = unset ? NULL : strchr(arg, '=');
+         size_t name_len = eq ? (size_t)(eq - arg) : strlen(arg);
+         if (!is_var_name(arg, name_len)) {
+             snprintf(msg, sizeof(msg), "%s: '%s': geçerli bir değişken adı değil\n", cmd, arg);
+             if (output_callback) output_callback(tab_index, msg, "red");
+             status = 1;
+             continue;
+         }
+         if (eq) *eq = '\0';
+         if (unset) var_unset(tab_index, arg);
+         else var_set(tab_index, arg, eq ? eq + 1 : NULL, 1);
+     }
+     token_list_free(&tokens);
+     if (tab_index >= 0 && tab_index < MAX_TABS) tab_last_status[tab_index] = status;
+ }
+ 
+ /**
+  * @brief Yalnızca "AD=değer" atamalarından oluşan satırı uygular
+  * * Atanan değişkenler dışa aktarılmış değilse çocuklara geçmez.
+  * * @return int Satır yalnızca atamalardan oluşuyorsa (uygulandıysa) 1
+  */
+ static int run_assignments(int tab_index, const char *line) {
+     if (line[strcspn(line, "= \t")] != '=') return 0; // İlk sözcükte '=' yoksa atama değildir
+     TokenList tokens;
+     const char *error;
+     if (tokenize(line, tab_index, &tokens, &error) == -1) return 0;
+     int only = tokens.argc > 0;
+     for (int i = 0; i < tokens.argc; i++) {
+         if (!(tokens.flags[i] & TOKEN_ASSIGN)) only = 0;
+     }
+     for (int i = 0; only && i < tokens.argc; i++) {
+         char *eq = strchr(tokens.argv[i], '=');
+         *eq = '\0';
+         var_set(tab_index, tokens.argv[i], eq + 1, 0);
+     }
+     token_list_free(&tokens);
+     if (only && tab_index >= 0 && tab_index < MAX_TABS) tab_last_status[tab_index] = 0;
+     return only;
+ }
+ 
+ // ------------------- Joker karakterler -------------------
+ 
+ #define DIR_CACHE_MAX_NAMES (1 << 20) // Önbellekteki toplam girdi sınırı (aşılınca LRU dizin atılır)
+ #define DIR_CACHE_MAX_WATCHES 256     // inotify ile izlenen en fazla dizin (soğuk olanlar mtime'a geçer)
+ #define GLOB_MAX_DEPTH 64             // "**" ile inilecek en fazla dizin derinliği
+ 
+ /**
+  * @brief Önbellekteki bir dizin listesi
+  * * Girdiler ada göre sıralı tutulur; böylece "app-*.log" gibi sabit önekli
+  * desenler ikili aramayla yalnızca ilgili aralığı tarar. names[i][-1] girdinin
+  * d_type değeridir. En son kullanılan DIR_CACHE_MAX_WATCHES dizin inotify ile
+  * izlenir; diğerleri (ve izlenemeyenler) her kullanımda mtime ile denetlenir.
+  * Kayıtlar LRU sırası için kendi içlerindeki bağlantılarla iki kuyruğa
+  * takılır; kullanım ve atma tabloyu taramadan O(1)'dir.
+  */
+ typedef struct {
+     char *path;               // Dizinin mutlak yolu ('/' ile biter; önbellek anahtarı)
+     char **names;             // Sıralı girdiler ("." ve ".." hariç), metinleriyle tek blokta
+     size_t count;             // Girdi sayısı
+     int wd;                   // inotify izlemesi (-1 = mtime ile denetlenir)
+     int stale;                // inotify değişiklik bildirdi, yeniden okunmalı
+     int busy;                 // Üzerinde gezinilirken önbellekten atılmaz
+     struct timespec mtime;    // Okunmadan hemen önceki değişiklik zamanı
+     time_t scanned;           // Okunduğu an
+     GList lru_link;           // dir_lru'daki yeri (data = kayıt)
+     GList watch_link;         // wd != -1 iken dir_watched'daki yeri
+ } DirListing;
+ 
+ static GHashTable *dir_cache = NULL;   // Mutlak yol -> DirListing
+ static GHashTable *dir_watches = NULL; // inotify watch tanımlayıcısı -> DirListing
+ static int dir_inotify_fd = -1;        // Önbellekteki dizinleri izleyen inotify
+ static size_t dir_cache_names = 0;     // Önbellekteki toplam girdi sayısı
+ static GQueue dir_lru = G_QUEUE_INIT;  // Tüm listeler, baş = en son kullanılan
+ static GQueue dir_watched = G_QUEUE_INIT; // İzlenen listeler, baş = en son kullanılan
+ static unsigned long dir_cache_hits = 0;
+ static unsigned long dir_cache_misses = 0;
+ 
+ /**
+  * @brief Listenin inotify izlemesini bırakır; liste bundan sonra mtime ile denetlenir
+  * * @param listing Liste
+  * @param remove İzleme çekirdekte de kaldırılsın mı (IN_IGNORED geldiyse zaten kalkmıştır)
+  */
+ static void dir_listing_unwatch(DirListing *listing, int remove) {
+     if (listing->wd == -1) return;
+     g_hash_table_remove(dir_watches, GINT_TO_POINTER(listing->wd));
+     if (remove) inotify_rm_watch(dir_inotify_fd, listing->wd);
+     g_queue_unlink(&dir_watched, &listing->watch_link);
+     listing->wd = -1;
+ }
+ 
+ /**
+  * @brief Listeyi en son kullanılan olarak işaretler
+  */
+ static void dir_listing_touch(DirListing *listing) {
+     g_queue_unlink(&dir_lru, &listing->lru_link);
+     g_queue_push_head_link(&dir_lru, &listing->lru_link);
+     if (listing->wd != -1) {
+         g_queue_unlink(&dir_watched, &listing->watch_link);
+         g_queue_push_head_link(&dir_watched, &listing->watch_link);
+     }
+ }
+ 
+ /**
+  * @brief DirListing'i serbest bırakır ve izlemesini kaldırır (GHashTable değer yok edicisi)
+  */
+ static void dir_listing_free(gpointer data) {
+     DirListing *listing = data;
+     dir_listing_unwatch(listing, 1);
+     g_queue_unlink(&dir_lru, &listing->lru_link);
+     dir_cache_names -= listing->count;
+     g_free(listing->names);
+     g_free(listing->path);
+     g_free(listing);
+ }
+ 
+ /**
+  * @brief İzlenen dizinlerdeki değişiklikleri işler
+  * * Girdi eklenen, silinen veya taşınan dizinin listesi bayat işaretlenir ve
+  * bir sonraki kullanımda yeniden okunur. Kuyruk taşarsa tüm listeler bayatlar.
+  */
+ static gboolean on_dir_changed(gint fd, GIOCondition condition, gpointer user_data) {
+     char buf[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+     ssize_t n;
+ 
+     while ((n = read(fd, buf, sizeof(buf))) > 0) {
+         for (char *p = buf; p < buf + n; ) {
+             struct inotify_event *ev = (struct inotify_event *)p;
+             if (ev->mask & IN_Q_OVERFLOW) {
+                 GHashTableIter it;
+                 gpointer value;
+                 g_hash_table_iter_init(&it, dir_cache);
+                 while (g_hash_table_iter_next(&it, NULL, &value)) ((DirListing *)value)->stale = 1;
+             } else {
+                 DirListing *listing = g_hash_table_lookup(dir_watches, GINT_TO_POINTER(ev->wd));
+                 if (listing) {
+                     listing->stale = 1;
+                     if (ev->mask & IN_IGNORED) { // Dizin silindi: izleme çekirdekte kalktı
+                         dir_listing_unwatch(listing, 0);
+                     }
+                 }
+             }
+             p += sizeof(struct inotify_event) + ev->len;
+         }
+     }
+     return G_SOURCE_CONTINUE;
+ }
+ 
+ /**
+  * @brief Dizin önbelleğini ve inotify örneğini kurar
+  */
+ static void dir_cache_init(void) {
+     dir_cache = g_hash_table_new_full(g_str_hash, g_str_equal, NULL, dir_listing_free);
+     dir_watches = g_hash_table_new(g_direct_hash, g_direct_equal);
+     dir_inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+     if (dir_inotify_fd == -1) {
+         perror("inotify_init1 failed"); // Önbellek mtime denetimiyle çalışmaya devam eder
+         return;
+     }
+     g_unix_fd_add(dir_inotify_fd, G_IO_IN, on_dir_changed, NULL);
+ }
+ 
+ /**
+  * @brief Dizini (yeniden) okur ve girdilerini sıralar
+  * * İzleme okumadan önce kurulur ve mtime okumadan önce alınır; okuma sırasında
+  * olan bir değişiklik listeyi hemen bayatlatır. İzleme sınırı doluysa en
+  * uzun süredir kullanılmayan izlenen listenin izlemesi bu listeye geçer.
+  * * @return int Başarılıysa 0, dizin açılamazsa -1
+  */
+ static int dir_listing_scan(DirListing *listing) {
+     if (listing->wd == -1 && dir_inotify_fd != -1) {
+         if (dir_watched.length >= DIR_CACHE_MAX_WATCHES) {
+             dir_listing_unwatch(g_queue_peek_tail(&dir_watched), 1);
+         }
+         int wd = inotify_add_watch(dir_inotify_fd, listing->path,
+                                    IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO |
+                                    IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR);
+         // Aynı dizine başka bir yoldan (sembolik bağ) ulaşılıyorsa izleme paylaşılamaz
+         if (wd != -1 && !g_hash_table_contains(dir_watches, GINT_TO_POINTER(wd))) {
+             listing->wd = wd;
+             g_hash_table_insert(dir_watches, GINT_TO_POINTER(wd), listing);
+             listing->watch_link.data = listing;
+             g_queue_push_head_link(&dir_watched, &listing->watch_link);
+         }
+     }
+     listing->stale = 0;
+ 
+     DIR *dir = opendir(listing->path);
+     if (!dir) return -1;
+     struct stat st;
+     if (fstat(dirfd(dir), &st) == 0) listing->mtime = st.st_mtim;
+     listing->scanned = time(NULL);
+ 
+     // Her girdi metinde "<d_type><ad>\0" olarak birikir; sonra tek bloğa kopyalanır
+     GString *text = g_string_new(NULL);
+     size_t count = 0;
+     struct dirent *ent;
+     while ((ent = readdir(dir))) {
+         if (ent->d_name[0] == '.' && (!ent->d_name[1] || (ent->d_name[1] == '.' && !ent->d_name[2]))) continue;
+         g_string_append_c(text, (char)ent->d_type);
+         g_string_append_len(text, ent->d_name, strlen(ent->d_name) + 1);
+         count++;
+     }
+     closedir(dir);
+ 
+     char **names = g_malloc(count * sizeof(char *) + text->len);
+     char *block = (char *)(names + count);
+     if (count) { // Boş dizinde names NULL'dır (g_malloc(0))
+         memcpy(block, text->str, text->len);
+         for (size_t i = 0, off = 0; i < count; i++) {
+             names[i] = block + off + 1;
+             off += strlen(names[i]) + 2;
+         }
+         qsort(names, count, sizeof(*names), compare_strings);
+     }
+     g_string_free(text, TRUE);
+ 
+     dir_cache_names += count - listing->count;
+     g_free(listing->names);
+     listing->names = names;
+     listing->count = count;
+     return 0;
+ }
+ 
+ /**
+  * @brief Dizinin listesini önbellekten döndürür; yoksa veya bayatsa okur
+  * * @param path Mutlak yol ('/' ile biter)
+  * @return DirListing* Liste veya dizin okunamazsa NULL
+  */
+ static DirListing* dir_listing_get(const char *path) {
+     if (!dir_cache) dir_cache_init();
+     DirListing *listing = g_hash_table_lookup(dir_cache, path);
+     if (listing && !listing->stale) {
+         // İzlenmeyen dizin: mtime değiştiyse veya okumayla aynı saniyede değiştiyse
+         // (zaman damgası çözünürlüğü yüzünden güvenilmez) yeniden okunur
+         struct stat st;
+         int fresh = listing->wd != -1 ||
+                     (stat(path, &st) == 0 && st.st_mtim.tv_sec == listing->mtime.tv_sec &&
+                      st.st_mtim.tv_nsec == listing->mtime.tv_nsec && listing->mtime.tv_sec < listing->scanned - 1);
+         if (fresh) {
+             dir_cache_hits++;
+             dir_listing_touch(listing);
+             return listing;
+         }
+     }
+ 
+     dir_cache_misses++;
+     if (!listing) {
+         listing = g_new0(DirListing, 1);
+         listing->path = g_strdup(path);
+         listing->wd = -1;
+         listing->lru_link.data = listing;
+         g_queue_push_head_link(&dir_lru, &listing->lru_link);
+         g_hash_table_insert(dir_cache, listing->path, listing);
+     }
+     if (dir_listing_scan(listing) == -1) {
+         g_hash_table_remove(dir_cache, path);
+         return NULL;
+     }
+     dir_listing_touch(listing);
+ 
+     // Sınır aşıldıysa en uzun süredir kullanılmayan listeler kuyruğun sonundan atılır
+     GList *link = dir_lru.tail;
+     while (dir_cache_names > DIR_CACHE_MAX_NAMES && link) {
+         DirListing *oldest = link->data;
+         link = link->prev;
+         if (oldest != listing && !oldest->busy) g_hash_table_remove(dir_cache, oldest->path);
+     }
+     return listing;
+ }
+ 
+ /**
+  * @brief Joker desenindeki bir yol bileşeni (ör. "src" veya "*.c")
+  */
+ typedef struct {
+     char *pattern;            // fnmatch deseni (kaçışlar korunur)
+     char *literal;            // Joker yoksa kaçışları kaldırılmış ad (NULL = joker var)
+     int recursive;            // "**": sıfır veya daha fazla dizin
+     char *prefix;             // Desenin baştaki sabit kısmı (kaçışsız)
+     size_t prefix_len;
+     const char *suffix;       // Son '*'dan sonraki sabit kısım (NULL = yok)
+     size_t suffix_len;
+     int simple;               // Desen tam olarak "önek*sonek": fnmatch gerekmez
+ } GlobComp;
+ 
+ /**
+  * @brief Joker genişletmesinin durumu
+  */
+ typedef struct {
+     GString *path;            // Gezilen dizinin mutlak yolu; çıktı root_len'den başlar
+     size_t root_len;          // Çıktıya girmeyen önek (göreli desenlerde sekmenin dizini)
+     GlobComp *comps;
+     int ncomps;
+     int dirs_only;            // Desen '/' ile bitiyor: yalnızca dizinler
+     GString *text;            // Eşleşmeler, NUL ile ayrılmış
+     GArray *offsets;          // Her eşleşmenin text içindeki başı (size_t)
+ } GlobWalk;
+ 
+ /**
+  * @brief Yol bileşenini ön işler: sabit önek/sonek ve hızlı yol tespiti
+  */
+ static void glob_comp_init(GlobComp *comp, char *pattern) {
+     memset(comp, 0, sizeof(*comp));
+     comp->pattern = pattern;
+     comp->recursive = strcmp(pattern, "**") == 0;
+     comp->prefix = g_malloc(strlen(pattern) + 1);
+ 
+     int metas = 0, stars = 0, escapes = 0;
+     const char *first_meta = NULL;
+     for (const char *p = pattern; *p; p++) {
+         if (*p == '\\' && p[1]) {
+             escapes++;
+             if (!first_meta) comp->prefix[comp->prefix_len++] = p[1];
+             p++;
+         } else if (strchr("*?[", *p)) {
+             if (!first_meta) first_meta = p;
+             metas++;
+             if (*p == '*') {
+                 stars++;
+                 comp->suffix = p + 1;
+             }
+         } else if (!first_meta) {
+             comp->prefix[comp->prefix_len++] = *p;
+         }
+     }
+     comp->prefix[comp->prefix_len] = '\0';
+     if (!first_meta) comp->literal = comp->prefix;
+     if (comp->suffix && comp->suffix[strcspn(comp->suffix, "*?[\\")] == '\0') {
+         comp->suffix_len = strlen(comp->suffix);
+     } else {
+         comp->suffix = NULL;
+     }
+     comp->simple = metas == 1 && stars == 1 && escapes == 0;
+ }
+ 
+ /**
+  * @brief Adın bileşen deseniyle eşleşip eşleşmediğini söyler (önek zaten doğrulandı)
+  * * '.' ile başlayan adlar yalnızca desen de '.' ile başlıyorsa eşleşir.
+  */
+ static int glob_comp_match(const GlobComp *comp, const char *name) {
+     size_t len = strlen(name);
+     if (comp->suffix) {
+         if (len < comp->prefix_len + comp->suffix_len) return 0;
+         if (memcmp(name + len - comp->suffix_len, comp->suffix, comp->suffix_len) != 0) return 0;
+     }
+     if (comp->simple) return comp->prefix_len > 0 || name[0] != '.';
+     return fnmatch(comp->pattern, name, FNM_PERIOD) == 0;
+ }
+ 
+ /**
+  * @brief Gezilen yolu (root_len'den sonrasını) eşleşme olarak ekler
+  */
+ static void glob_emit(GlobWalk *w) {
+     size_t off = w->text->len;
+     g_array_append_val(w->offsets, off);
+     g_string_append_len(w->text, w->path->str + w->root_len, w->path->len - w->root_len);
+     if (w->dirs_only) g_string_append_c(w->text, '/');
+     g_string_append_c(w->text, '\0');
+ }
+ 
+ /**
+  * @brief Listedeki girdinin dizin olup olmadığını söyler
+  * * d_type bilinmiyorsa lstat ile öğrenilip listeye yazılır. follow verilirse
+  * dizine giden sembolik bağlar da dizin sayılır ("**" bağları izlemez).
+  */
+ static int glob_entry_is_dir(GlobWalk *w, char *name, int follow) {
+     unsigned char type = (unsigned char)name[-1];
+     if (type == DT_DIR) return 1;
+     if (type != DT_UNKNOWN && (type != DT_LNK || !follow)) return 0;
+ 
+     size_t len = w->path->len;
+     g_string_append(w->path, name);
+     struct stat st;
+     int ok = (follow ? stat(w->path->str, &st) : lstat(w->path->str, &st)) == 0 && S_ISDIR(st.st_mode);
+     if (type == DT_UNKNOWN && !follow && lstat(w->path->str, &st) == 0) {
+         name[-1] = S_ISDIR(st.st_mode) ? DT_DIR : S_ISLNK(st.st_mode) ? DT_LNK : DT_REG;
+     }
+     g_string_truncate(w->path, len);
+     return ok;
+ }
+ 
+ /**
+  * @brief Desenin i. bileşeninden itibaren geçerli dizinde eşleşmeleri arar
+  * * w->path her zaman '/' ile biten bir dizindir. Sonuçlar dizin sırası
+  * korunarak ada göre sıralı üretilir.
+  */
+ static void glob_walk(GlobWalk *w, int i, int depth) {
+     if (i == w->ncomps) {
+         glob_emit(w);
+         return;
+     }
+     GlobComp *comp = &w->comps[i];
+     int last = i == w->ncomps - 1;
+     size_t len = w->path->len;
+ 
+     if (comp->literal && !comp->recursive) {
+         // Joker içermeyen bileşen listelenmez; yalnızca sonuncunun varlığı denetlenir
+         g_string_append(w->path, comp->literal);
+         if (last) {
+             struct stat st;
+             if (w->dirs_only ? stat(w->path->str, &st) == 0 && S_ISDIR(st.st_mode)
+                              : lstat(w->path->str, &st) == 0) {
+                 glob_emit(w);
+             }
+         } else {
+             g_string_append_c(w->path, '/');
+             glob_walk(w, i + 1, depth);
+         }
+         g_string_truncate(w->path, len);
+         return;
+     }
+     if (depth > GLOB_MAX_DEPTH) return;
+ 
+     DirListing *listing = dir_listing_get(w->path->str);
+     if (!listing) return;
+     listing->busy++;
+ 
+     if (comp->recursive && !last) glob_walk(w, i + 1, depth); // Sıfır dizin
+ 
+     // Sabit önekli desenler için sıralı listede ikili aramayla başlangıç bulunur
+     size_t lo = 0, hi = listing->count;
+     if (comp->prefix_len && !comp->recursive) {
+         while (lo < hi) {
+             size_t mid = lo + (hi - lo) / 2;
+             if (strcmp(listing->names[mid], comp->prefix) < 0) lo = mid + 1;
+             else hi = mid;
+         }
+     }
+     for (size_t k = lo; k < listing->count; k++) {
+         char *name = listing->names[k];
+         if (comp->recursive) {
+             if (name[0] == '.') continue;
+             int is_dir = glob_entry_is_dir(w, name, 0);
+             g_string_append(w->path, name);
+             if (last && (is_dir || !w->dirs_only)) glob_emit(w);
+             if (is_dir) {
+                 g_string_append_c(w->path, '/');
+                 glob_walk(w, i, depth + 1);
+             }
+         } else {
+             if (comp->prefix_len && strncmp(name, comp->prefix, comp->prefix_len) != 0) break;
+             if (!glob_comp_match(comp, name)) continue;
+             if (last && !w->dirs_only) {
+                 g_string_append(w->path, name);
+                 glob_emit(w);
+             } else if (glob_entry_is_dir(w, name, 1)) {
+                 g_string_append(w->path, name);
+                 g_string_append_c(w->path, '/');
+                 if (last) g_string_truncate(w->path, w->path->len - 1); // glob_emit '/' ekler
+                 glob_walk(w, last ? w->ncomps : i + 1, depth);
+             }
+         }
+         g_string_truncate(w->path, len);
+     }
+     listing->busy--;
+ }
+ 
+ /**
+  * @brief Tek bir joker desenini eşleşen yollara genişletir
+  * * Göreli desenler sekmenin dizinine göre çözülür; sonuçlar desenle aynı
+  * biçimde (göreli/mutlak) üretilir.
+  * * @param base Sekmenin dizini
+  * @param pattern Kaçışlı desen (tırnaklı jokerler \ ile)
+  * @param text Eşleşmelerin ekleneceği metin
+  * @param offsets Eşleşmelerin başlangıçları
+  * @return size_t Eşleşme sayısı
+  */
+ static size_t glob_pattern(const char *base, const char *pattern, GString *text, GArray *offsets) {
+     GlobWalk w = { .text = text, .offsets = offsets };
+     w.path = g_string_new(NULL);
+     if (pattern[0] != '/') {
+         g_string_append(w.path, base);
+         if (w.path->len == 0 || w.path->str[w.path->len - 1] != '/') g_string_append_c(w.path, '/');
+         w.root_len = w.path->len;
+     } else {
+         g_string_append_c(w.path, '/');
+     }
+ 
+     char *copy = g_strdup(pattern);
+     size_t copy_len = strlen(copy);
+     w.dirs_only = copy_len > 1 && copy[copy_len - 1] == '/';
+     GlobComp *comps = g_new(GlobComp, copy_len / 2 + 1);
+     char *saveptr;
+     for (char *c = strtok_r(copy, "/", &saveptr); c; c = strtok_r(NULL, "/", &saveptr)) {
+         glob_comp_init(&comps[w.ncomps++], c);
+     }
+     w.comps = comps;
+ 
+     size_t before = offsets->len;
+     if (w.ncomps > 0) glob_walk(&w, 0, 0);
+ 
+     for (int i = 0; i < w.ncomps; i++) g_free(comps[i].prefix);
+     g_free(comps);
+     g_free(copy);
+     g_string_free(w.path, TRUE);
+     return offsets->len - before;
+ }
+ 
+ /**
+  * @brief TOKEN_GLOB işaretli sözcükleri eşleşen yollarla değiştirir
+  * * Eşleşmeyen desenler (bash'te olduğu gibi) kaçışları kaldırılarak aynen
+  * kalır. Yönlendirme hedefi olan desen yalnızca tek dosyayla eşleşirse
+  * genişletilir. Dizin listeleri dir_listing_get ile önbellekten gelir; aynı
+  * dizinler üzerindeki tekrar eden genişletmeler dizini yeniden taramaz.
+  * Yeni argv, bayraklar ve eşleşme metinleri tek blokta list->expanded'e konur;
+  * diğer sözcükler arenada kalır.
+  */
+ static void glob_expand(int tab_index, TokenList *list) {
+     const TabDir *cwd = tab_dir_get(tab_index);
+     const char *base = cwd ? cwd->path : ".";
+     if (dir_inotify_fd != -1) on_dir_changed(dir_inotify_fd, G_IO_IN, NULL); // Bekleyen olaylar önce işlenir
+ 
+     // words: her çıktı sözcüğü için ya arenadaki belirteç ya da text içindeki eşleşme
+     typedef struct {
+         char *token;
+         size_t offset;
+         unsigned char flags;
+     } GlobWord;
+     GArray *words = g_array_new(FALSE, FALSE, sizeof(GlobWord));
+     GArray *offsets = g_array_new(FALSE, FALSE, sizeof(size_t));
+     GString *text = g_string_new(NULL);
+ 
+     for (int i = 0; i < list->argc; i++) {
+         char *token = list->argv[i];
+         if (list->flags[i] & TOKEN_GLOB) {
+             size_t text_len = text->len;
+             size_t first = offsets->len;
+             size_t matches = glob_pattern(base, token, text, offsets);
+             int redirect = i > 0 && (list->flags[i - 1] & TOKEN_OP) && strpbrk(list->argv[i - 1], "<>");
+             if (matches > 0 && (!redirect || matches == 1)) {
+                 for (size_t k = first; k < offsets->len; k++) {
+                     GlobWord word = { NULL, g_array_index(offsets, size_t, k), 0 };
+                     g_array_append_val(words, word);
+                 }
+                 continue;
+             }
+             g_string_truncate(text, text_len);
+             g_array_set_size(offsets, first);
+             token[unescape_in_place(token, strlen(token))] = '\0';
+         }
+         GlobWord word = { token, 0, list->flags[i] & ~TOKEN_GLOB };
+         g_array_append_val(words, word);
+     }
+ 
+     size_t count = words->len;
+     char **argv = g_malloc((count + 1) * sizeof(char *) + count + text->len);
+     unsigned char *flags = (unsigned char *)(argv + count + 1);
+     char *block = (char *)flags + count;
+     memcpy(block, text->str, text->len);
+     for (size_t i = 0; i < count; i++) {
+         GlobWord *word = &g_array_index(words, GlobWord, i);
+         argv[i] = word->token ? word->token : block + word->offset;
+         flags[i] = word->flags;
+     }
+     argv[count] = NULL;
+     list->argv = argv;
+     list->flags = flags;
+     list->argc = count;
+     list->expanded = argv;
+ 
+     g_array_free(words, TRUE);
+     g_array_free(offsets, TRUE);
+     g_string_free(text, TRUE);
+ }
+ 
+ // ------------------- Kaynak sınırları -------------------
+ 
+ /**
+  * @brief Bayt sayısını okunur biçimde yazar (KB/MB/GB)
+  */
+ static void format_size(size_t bytes, char *out, size_t size) {
+     if (bytes >= (size_t)1 << 30) snprintf(out, size, "%.2f GB", bytes / (double)(1 << 30));
+     else if (bytes >= 1 << 20) snprintf(out, size, "%.1f MB", bytes / (double)(1 << 20));
+     else snprintf(out, size, "%.1f KB", bytes / 1024.0);
+ }
+ 
+ #define LIMIT_KILL_GRACE_US (2 * G_USEC_PER_SEC) // Süre dolunca SIGTERM'den SIGKILL'e kadar beklenen süre
+ 
+ /**
+  * @brief Bir komuta veya sekmeye uygulanan sınırlar (0 = sınır yok)
+  * * Kaynak sınırları çocukta exec'ten önce setrlimit ile konur (bkz. launcher.c);
+  * duvar saati sınırı ise tüm işler için tek bir timerfd ile izlenir.
+  */
+ typedef struct {
+     guint64 timeout_us;       // Duvar saati süresi; dolunca iş SIGTERM, ardından SIGKILL alır
+     guint64 cpu_s;            // CPU süresi (RLIMIT_CPU, saniye)
+     guint64 as_bytes;         // Adres alanı (RLIMIT_AS, bayt)
+     guint64 nofile;           // Açık dosya sayısı (RLIMIT_NOFILE)
+ } JobLimits;
+ 
+ static JobLimits tab_limits[MAX_TABS];  // "limit" ile konan sekme varsayılanları
+ static GQueue job_deadlines;            // Süre sınırı olan işler, en yakın sınır başta
+ static int job_timer_fd = -1;           // En yakın sınıra kurulan timerfd
+ 
+ static gboolean on_job_timer(gint fd, GIOCondition condition, gpointer user_data);
+ 
+ /**
+  * @brief Sınırları launcher'ın setrlimit listesine çevirir
+  * * @param limits Sınırlar
+  * @param out En az 3 elemanlı hedef dizi
+  * @return int Yazılan sınır sayısı
+  */
+ static int job_limits_to_launch(const JobLimits *limits, LaunchLimit *out) {
+     int n = 0;
+     // Yumuşak CPU sınırında SIGXCPU gelir; süreç onu yakalarsa bir saniye sonra SIGKILL
+     if (limits->cpu_s) out[n++] = (LaunchLimit){ RLIMIT_CPU, limits->cpu_s, limits->cpu_s + 1 };
+     if (limits->as_bytes) out[n++] = (LaunchLimit){ RLIMIT_AS, limits->as_bytes, limits->as_bytes };
+     if (limits->nofile) out[n++] = (LaunchLimit){ RLIMIT_NOFILE, limits->nofile, limits->nofile };
+     return n;
+ }
+ 
+ /**
+  * @brief timerfd'yi en yakın süre sınırına kurar; sınır kalmadıysa durdurur
+  */
+ static void job_timer_arm(void) {
+     Job *first = g_queue_peek_head(&job_deadlines);
+     if (job_timer_fd == -1) {
+         if (!first) return;
+         job_timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+         if (job_timer_fd == -1) {
+             perror("timerfd_create failed");
+             return;
+         }
+         g_unix_fd_add(job_timer_fd, G_IO_IN, on_job_timer, NULL);
+     }
+     // g_get_monotonic_time de CLOCK_MONOTONIC kullanır; geçmişteki bir an hemen tetikler
+     struct itimerspec its = { 0 };
+     if (first) {
+         its.it_value.tv_sec = first->deadline_us / G_USEC_PER_SEC;
+         its.it_value.tv_nsec = first->deadline_us % G_USEC_PER_SEC * 1000;
+     }
+     timerfd_settime(job_timer_fd, TFD_TIMER_ABSTIME, &its, NULL);
+ }
+ 
+ /**
+  * @brief İşi süre sınırı listesinden çıkarır
+  */
+ static void job_clear_deadline(Job *job) {
+     if (!job->deadline_us) return;
+     g_queue_remove(&job_deadlines, job);
+     job->deadline_us = 0;
+     job_timer_arm();
+ }
+ 
+ /**
+  * @brief İşin süre sınırını kurar; liste sıralı tutulur
+  * * @param job İş
+  * @param deadline_us Sınırın dolacağı an (monoton saat)
+  */
+ static void job_set_deadline(Job *job, gint64 deadline_us) {
+     if (job->deadline_us) g_queue_remove(&job_deadlines, job);
+     job->deadline_us = deadline_us;
+     GList *link = job_deadlines.head;
+     while (link && ((Job *)link->data)->deadline_us <= deadline_us) link = link->next;
+     if (link) g_queue_insert_before(&job_deadlines, link, job);
+     else g_queue_push_tail(&job_deadlines, job);
+     job_timer_arm();
+ }
+ 
+ /**
+  * @brief Süre sınırı dolan işi sonlandırır
+  * * Önce SIGTERM gönderilir (durdurulmuşsa SIGCONT ile uyandırılır); iş
+  * LIMIT_KILL_GRACE_US içinde bitmezse SIGKILL gönderilir.
+  */
+ static void job_timeout(Job *job, gint64 now) {
+     if (job->pgid <= 0) return;
+     if (job->timeout_stage == 0) {
+         if (output_callback) {
+             char elapsed[32], msg[384];
+             format_seconds(elapsed, sizeof(elapsed), now - job->start_us);
+             snprintf(msg, sizeof(msg), "[limit: %s süre sınırı doldu, iş sonlandırılıyor] %s\n",
+                      elapsed, job->command);
+             output_callback(job->tab_index, msg, "orange");
+         }
+         job->timeout_stage = 1;
+         kill(-job->pgid, SIGTERM);
+         if (job->stopped) kill(-job->pgid, SIGCONT);
+         job_set_deadline(job, now + LIMIT_KILL_GRACE_US);
+     } else {
+         kill(-job->pgid, SIGKILL);
+     }
+ }
+ 
+ /**
+  * @brief timerfd tetiklendiğinde süresi dolan işleri sonlandırır
+  */
+ static gboolean on_job_timer(gint fd, GIOCondition condition, gpointer user_data) {
+     uint64_t expirations;
+     ssize_t unused = read(fd, &expirations, sizeof(expirations));
+     (void)unused;
+     gint64 now = g_get_monotonic_time();
+     Job *job;
+     while ((job = g_queue_peek_head(&job_deadlines)) && job->deadline_us <= now) {
+         g_queue_pop_head(&job_deadlines);
+         job->deadline_us = 0;
+         job_timeout(job, now);
+     }
+     job_timer_arm();
+     return G_SOURCE_CONTINUE;
+ }
+ 
+ /**
+  * @brief "30", "30s", "500ms", "1.5m", "2h" biçimindeki süreyi çözer
+  * * @param text Metin
+  * @param end Sayıdan (ve birimden) sonraki konum yazılır
+  * @param us Süre (mikrosaniye)
+  * @return int 0 veya geçersizse -1
+  */
+ static int parse_duration(const char *text, const char **end, guint64 *us) {
+     char *p;
+     double value = g_ascii_strtod(text, &p); // Yerel ayardan bağımsız ("1.5")
+     if (p == text || !isdigit((unsigned char)*text) || value < 0) return -1;
+     double scale = G_USEC_PER_SEC;
+     if (strncmp(p, "ms", 2) == 0) {
+         scale = 1000;
+         p += 2;
+     } else if (*p && strchr("smh", *p)) {
+         scale *= *p == 'h' ? 3600 : *p == 'm' ? 60 : 1;
+         p++;
+     }
+     *us = (guint64)(value * scale);
+     *end = p;
+     return 0;
+ }
+ 
+ /**
+  * @brief "4096", "64K", "512M", "2G" biçimindeki boyutu (1024 tabanlı) çözer
+  * * @return int 0 veya geçersizse -1
+  */
+ static int parse_size(const char *text, const char **end, guint64 *bytes) {
+     static const char units[] = "KMGT";
+     char *p;
+     if (!isdigit((unsigned char)*text)) return -1;
+     guint64 value = strtoull(text, &p, 10);
+     const char *unit = *p ? strchr(units, toupper((unsigned char)*p)) : NULL;
+     if (unit) {
+         value <<= 10 * (unit - units + 1);
+         p++;
+     }
+     *bytes = value;
+     *end = p;
+     return 0;
+ }
+ 
+ /**
+  * @brief "limit" seçeneklerini çözer
+  * * -t süre, -c cpu süresi, -m bellek, -n dosya sayısı; 0 o sınırı kaldırır,
+  * -r tüm sınırları sıfırlar.
+  * * @param tab_index Hata mesajının yazılacağı sekme
+  * @param args Komut adından sonraki kısım
+  * @param limits Seçeneklere göre güncellenir
+  * @return const char* Seçeneklerden sonraki komut ("" = yok) veya hata için NULL
+  */
+ static const char* limit_parse(int tab_index, const char *args, JobLimits *limits) {
+     const char *p = args;
+     while (*p == '-') {
+         const char *value = p + 2 + strspn(p + 2, " \t"); // "-t30s" ve "-t 30s"
+         const char *end = p + 2;
+         guint64 n = 0;
+         int rc = -1;
+         switch (p[1]) {
+         case 'r':
+             memset(limits, 0, sizeof(*limits));
+             rc = 0;
+             break;
+         case 't':
+             rc = parse_duration(value, &end, &limits->timeout_us);
+             break;
+         case 'c':
+             rc = parse_duration(value, &end, &n);
+             limits->cpu_s = (n + G_USEC_PER_SEC - 1) / G_USEC_PER_SEC; // RLIMIT_CPU saniye birimlidir
+             break;
+         case 'm':
+             rc = parse_size(value, &end, &limits->as_bytes);
+             break;
+         case 'n':
+             if (isdigit((unsigned char)*value)) {
+                 limits->nofile = strtoull(value, (char **)&end, 10);
+                 rc = 0;
+             }
+             break;
+         }
+         if (rc == -1 || (*end && !isspace((unsigned char)*end))) {
+             char msg[320];
+             snprintf(msg, sizeof(msg), "limit: geçersiz seçenek: %.*s\n"
+                      "Kullanım: limit [-t süre] [-c cpu] [-m bellek] [-n dosya] [-r] [komut]\n",
+                      (int)strcspn(p, " \t"), p);
+             command_error(tab_index, msg);
+             return NULL;
+         }
+         p = end + strspn(end, " \t");
+     }
+     return p;
+ }
+ 
+ /**
+  * @brief Sekmenin varsayılan sınırlarını yazar
+  */
+ static void show_limits(int tab_index) {
+     const JobLimits *limits = &tab_limits[tab_index];
+     char timeout[32] = "yok", cpu[32] = "yok", mem[32] = "yok", files[32] = "yok";
+     if (limits->timeout_us) format_seconds(timeout, sizeof(timeout), limits->timeout_us);
+     if (limits->cpu_s) snprintf(cpu, sizeof(cpu), "%llus", (unsigned long long)limits->cpu_s);
+     if (limits->as_bytes) format_size(limits->as_bytes, mem, sizeof(mem));
+     if (limits->nofile) snprintf(files, sizeof(files), "%llu", (unsigned long long)limits->nofile);
+ 
+     char msg[256];
+     snprintf(msg, sizeof(msg), "Sekme sınırları:\n  -t süre    %s\n  -c cpu     %s\n"
+              "  -m bellek  %s\n  -n dosya   %s\n", timeout, cpu, mem, files);
+     if (output_callback) output_callback(tab_index, msg, "lightgreen");
+ }
+ 
+ // ------------------- Çıktı yakalama -------------------
+ 
+ #define MAX_CAPTURES 16 // Saklanan en fazla yakalama (en eskisi silinir)
+ 
+ /**
+  * @brief Sekmede gösterilemeyecek kadar büyük bir çıktının diskteki kopyası
+  */
+ typedef struct {
+     int id;                   // "capture" komutlarında kullanılan numara
+     int fd;                   // Yakalama dosyası (adsız, O_TMPFILE)
+     size_t size;              // Dosyadaki bayt sayısı
+     int tab_index;            // Çıktının ait olduğu sekme
+     char command[256];        // Çıktıyı üreten komut
+     char *export_path;        // "capture open" için oluşturulan adlı kopya (NULL = yok)
+ } Capture;
+ 
+ static Capture *captures[MAX_CAPTURES];
+ static int next_capture_id = 1;
+ 
+ /**
+  * @brief Çıktının tamamı için adsız bir geçici dosya açar
+  * * Dosya TMPDIR altında O_TMPFILE ile açılır; hiçbir dizinde görünmez ve son fd
+  * kapandığında diskten silinir. Bellek yerine disk kullanıldığı için çok büyük
+  * çıktılarda da bellek kullanımı sınırlı kalır.
+  * * @return int Dosya tanımlayıcısı veya hata durumunda -1
+  */
+ static int open_capture_file(void) {
+     const char *dir = g_get_tmp_dir();
+     int fd = open(dir, O_TMPFILE | O_RDWR | O_CLOEXEC, 0600);
+     if (fd != -1) return fd;
+ 
+     // O_TMPFILE desteklenmiyorsa adlı dosya oluşturup hemen sil
+     char path[PATH_MAX];
+     snprintf(path, sizeof(path), "%s/simple-shell-XXXXXX", dir);
+     fd = mkostemp(path, O_CLOEXEC);
+     if (fd != -1) unlink(path);
+     return fd;
+ }
+ 
+ /**
+  * @brief Tamponun tamamını dosyaya yazar (kısa yazmaları tamamlar)
+  * * @return int Başarılıysa 0, hata durumunda -1 (errno ayarlı)
+  */
+ static int write_all(int fd, const char *data, size_t len) {
+     while (len > 0) {
+         ssize_t n = write(fd, data, len);
+         if (n == -1 && errno == EINTR) continue;
+         if (n == -1) return -1;
+         data += n;
+         len -= n;
+     }
+     return 0;
+ }
+ 
+ /**
+  * @brief Yakalama numarasına göre kaydı bulur
+  */
+ static Capture* find_capture(int id) {
+     for (int i = 0; i < MAX_CAPTURES; i++) {
+         if (captures[i] && captures[i]->id == id) return captures[i];
+     }
+     return NULL;
+ }
+ 
+ /**
+  * @brief Yakalamayı kapatır; dosya ve "capture open" kopyası diskten silinir
+  */
+ static void capture_free(Capture *cap) {
+     for (int i = 0; i < MAX_CAPTURES; i++) {
+         if (captures[i] == cap) captures[i] = NULL;
+     }
+     if (cap->export_path) {
+         unlink(cap->export_path);
+         g_free(cap->export_path);
+     }
+     close(cap->fd);
+     g_free(cap);
+ }
+ 
+ /**
+  * @brief Tüm yakalamaları kapatır (model_cleanup için)
+  */
+ static void captures_free_all(void) {
+     for (int i = 0; i < MAX_CAPTURES; i++) {
+         if (captures[i]) capture_free(captures[i]);
+     }
+ }
+ 
+ /**
+  * @brief Yakalama dosyasına yazılamadığında dosyayı bırakır
+  * * Çocuk yine sonlandırılmaz; pencereyi aşan çıktı okunup atılır.
+  * * @param job İlgili iş
+  * @param error Yazma hatası (errno)
+  */
+ static void job_capture_failed(Job *job, int error) {
+     if (job->capture_fd != -1) close(job->capture_fd);
+     job->capture_fd = -1;
+     job->capture_error = error;
+     if (output_callback) {
+         char msg[256];
+         snprintf(msg, sizeof(msg), "\n[Uyarı: Çıktı dosyaya yazılamadı: %s; fazlası atılıyor]\n", strerror(error));
+         output_callback(job->tab_index, msg, "orange");
+     }
+ }
+ 
+ /**
+  * @brief Çıktı pencereyi ilk kez aştığında yakalama dosyasını açar
+  * * Pencereye sığan çıktılar için dosya hiç açılmaz (fd ve disk kullanılmaz).
+  * Dosya açıldığında bellekte tutulan baş kısım önce oraya yazılır, böylece
+  * dosya çıktının tamamını içerir. Açma veya yazma başarısız olursa bir daha
+  * denenmez.
+  * * @param job Çıktısı pencereyi aşan iş
+  * @return int Dosya kullanılabiliyorsa 1, değilse 0
+  */
+ static int job_open_capture(Job *job) {
+     if (job->capture_fd != -1) return 1;
+     if (job->capture_error || job->subst) return 0;
+     job->capture_fd = open_capture_file();
+     int error = job->capture_fd == -1 ? errno : 0;
+     if (!error && job->head && write_all(job->capture_fd, job->head->str, job->head->len) == -1) {
+         error = errno;
+     }
+     if (job->head) {
+         g_string_free(job->head, TRUE);
+         job->head = NULL;
+     }
+     if (error) {
+         job_capture_failed(job, error);
+         return 0;
+     }
+     return 1;
+ }
+ 
+ /**
+  * @brief İş bittiğinde yakalama dosyasını saklar veya kapatır
+  * * Çıktı sekmeye sığdıysa dosya kapatılır (ve silinir). Sığmadıysa dosya
+  * "capture" komutlarıyla açılabilir / kaydedilebilir / aranabilir hale gelir.
+  * * @param job Biten iş
+  */
+ static void job_finish_capture(Job *job) {
+     if (job->head) {
+         g_string_free(job->head, TRUE);
+         job->head = NULL;
+     }
+     if (job->capture_fd == -1) return;
+     if (job->total_bytes <= MAX_OUTPUT_BYTES) {
+         close(job->capture_fd);
+         job->capture_fd = -1;
+         return;
+     }
+ 
+     Capture *cap = g_new0(Capture, 1);
+     cap->id = next_capture_id++;
+     cap->fd = job->capture_fd;
+     cap->size = job->total_bytes;
+     cap->tab_index = job->tab_index;
+     g_strlcpy(cap->command, job->command, sizeof(cap->command));
+     job->capture_fd = -1;
+ 
+     int slot = 0;
+     for (int i = 0; i < MAX_CAPTURES; i++) {
+         if (!captures[i]) { slot = i; break; }
+         if (captures[i]->id < captures[slot]->id) slot = i; // Doluysa en eskisi
+     }
+     if (captures[slot]) capture_free(captures[slot]);
+     captures[slot] = cap;
+ 
+     if (output_callback) {
+         char size[32], msg[512];
+         format_size(cap->size, size, sizeof(size));
+         snprintf(msg, sizeof(msg),
+                  "[Çıktı: %s yakalandı, sekmede ilk %d KB ve son %d KB gösterildi - "
+                  "capture open %d | capture save %d <dosya> | capture search %d <metin>]\n",
+                  size, MAX_OUTPUT_BYTES / 1000, OUTPUT_TAIL_BYTES / 1000, cap->id, cap->id, cap->id);
+         output_callback(job->tab_index, msg, "orange");
+     }
+ }
+ 
+ /**
+  * @brief waitpid durumunu kabuk çıkış koduna çevirir
+  * * @param status waitpid durum değeri (-1 = bilinmiyor)
+  * @return int 0-255 arası çıkış kodu (sinyalle ölenler için 128+sinyal)
+  */
+ static int status_to_exit_code(int status) {
+     if (status == -1) return 255;
+     if (WIFEXITED(status)) return WEXITSTATUS(status);
+     if (WIFSIGNALED(status)) return 128 + WTERMSIG(status);
+     return 255;
+ }
+ 
+ static void execute_line(int tab_index, const char *cmdline);
+ static void run_list(int tab_index, const char *list, int op);
+ static void subst_append(struct Substitution *subst, const char *data, size_t len);
+ static void subst_finish(int tab_index, struct Substitution *subst, int status);
+ static void subst_free(struct Substitution *subst);
+ static void parallel_output(Job *job, const char *data, size_t len);
+ static void parallel_job_done(Job *job);
+ 
+ /**
+  * @brief "time" ile başlatılan işin süre ve kaynak özetini yazar
+  * * @param job Biten iş
+  */
+ static void job_report_time(const Job *job) {
+     if (!output_callback) return;
+     char real[32], user[32], sys[32], msg[256];
+     format_seconds(real, sizeof(real), job->end_us - job->start_us);
+     format_seconds(user, sizeof(user), job->user_us);
+     format_seconds(sys, sizeof(sys), job->sys_us);
+     snprintf(msg, sizeof(msg), "\nreal\t%s\nuser\t%s\nsys\t%s\nmaxrss\t%ldK\nmajflt\t%ld\nexit\t%d\n",
+              real, user, sys, job->max_rss_kb, job->major_faults, status_to_exit_code(job->last_status));
+     output_callback(job->tab_index, msg, "lightblue");
+ }
+ 
+ /**
+  * @brief İşi sekmenin iş tablosuna ekler ve sekme içindeki numarasını (%n) verir
+  * * Numara, sekmedeki en büyük iş numarasının bir fazlasıdır (bash'teki gibi);
+  * bu değer tab_next_job_id'de tutulduğu için tablo taranmaz.
+  * * @param job Eklenecek iş (geçersiz sekmedeyse tabloya girmez, numarası 0 kalır)
+  */
+ static void job_register(Job *job) {
+     int tab = job->tab_index;
+     if (tab < 0 || tab >= MAX_TABS) return;
+     if (!tab_jobs[tab]) {
+         tab_jobs[tab] = g_hash_table_new(g_direct_hash, g_direct_equal);
+         tab_next_job_id[tab] = 1;
+     }
+     job->id = tab_next_job_id[tab]++;
+     g_hash_table_insert(tab_jobs[tab], GINT_TO_POINTER(job->id), job);
+ }
+ 
+ /**
+  * @brief İşi sekmenin iş tablosundan çıkarır
+  * * En büyük numaralı iş çıktıysa sıradaki numara, kalan en büyük numaranın
+  * bir fazlasına iner (her numara en fazla bir kez geri alındığından toplamda O(1)).
+  * * @param job Çıkarılacak iş (tabloda değilse bir şey yapılmaz)
+  */
+ static void job_unregister(Job *job) {
+     int tab = job->tab_index;
+     if (tab < 0 || tab >= MAX_TABS || !tab_jobs[tab] || job->id <= 0) return;
+     if (g_hash_table_lookup(tab_jobs[tab], GINT_TO_POINTER(job->id)) != job) return;
+     g_hash_table_remove(tab_jobs[tab], GINT_TO_POINTER(job->id));
+     while (tab_next_job_id[tab] > 1 &&
+            !g_hash_table_contains(tab_jobs[tab], GINT_TO_POINTER(tab_next_job_id[tab] - 1))) {
+         tab_next_job_id[tab]--;
+     }
+ }
+ 
+ /**
+  * @brief Sekmedeki bir işi iş belirtecine göre bulur
+  * * "%n" n numaralı işi; boş belirteç, "%", "%%" ve "%+" geçerli işi (en büyük
+  * numaralı iş) seçer.
+  * * @param tab_index İşin sekmesi
+  * @param spec İş belirteci (NULL olabilir)
+  * @return Job* Bulunan iş veya NULL
+  */
+ static Job* find_job(int tab_index, const char *spec) {
+     int id = 0;
+     if (spec && *spec && strcmp(spec, "%") != 0 && strcmp(spec, "%%") != 0 && strcmp(spec, "%+") != 0) {
+         char *end;
+         if (spec[0] != '%') return NULL;
+         id = (int)strtol(spec + 1, &end, 10);
+         if (*end != '\0' || id <= 0) return NULL;
+     }
+ 
+     if (tab_index < 0 || tab_index >= MAX_TABS || !tab_jobs[tab_index]) return NULL;
+     if (!id) id = tab_next_job_id[tab_index] - 1; // Geçerli iş: en büyük numara
+     return g_hash_table_lookup(tab_jobs[tab_index], GINT_TO_POINTER(id));
+ }
+ 
+ /**
+  * @brief İşin tüm süreçlerinin process tablosundaki durumunu günceller
+  * * Bitmiş (toplanmış) süreçlere dokunulmaz.
+  * * @param job İlgili iş
+  * @param status Yeni durum (0=çalışıyor, 3=durduruldu)
+  */
+ static void job_set_process_status(Job *job, int status) {
+     for (int i = 0; i < job->npids; i++) {
+         ProcessInfo *proc = process_get(job->procs[i]);
+         if (proc && (proc->status == 0 || proc->status == 3)) {
+             process_set_status(proc, status);
+         }
+     }
+ }
+ 
+ /**
+  * @brief Sekmenin yeni komut kabul edip edemeyeceğini söyler
+  * * @param tab_index Sekme
+  * @return int Ön planda iş varsa veya "wait" bekliyorsa 1
+  */
+ static int tab_is_busy(int tab_index) {
+     if (tab_index < 0 || tab_index >= MAX_TABS) return 0;
+     return tab_fg_job[tab_index] != NULL || tab_fg_parallel[tab_index] != NULL ||
+            tab_wait_id[tab_index] != 0;
+ }
+ 
+ /**
+  * @brief "wait" bekleyen sekmenin beklediği işlerin bitip bitmediğini denetler
+  * * Durdurulmuş işler beklenmez (yoksa sekme sonsuza dek kilitlenirdi).
+  * * @param tab_index Sekme
+  * @return int Bekleme bittiyse (sekme serbest kaldıysa) 1
+  */
+ static int tab_check_wait(int tab_index) {
+     int target = tab_wait_id[tab_index];
+     if (target == 0) return 0;
+     if (tab_jobs[tab_index]) {
+         if (target > 0) {
+             Job *job = g_hash_table_lookup(tab_jobs[tab_index], GINT_TO_POINTER(target));
+             if (job && !job->stopped) return 0;
+         } else {
+             GHashTableIter it;
+             gpointer value;
+             g_hash_table_iter_init(&it, tab_jobs[tab_index]); // Yalnızca bu sekmenin işleri
+             while (g_hash_table_iter_next(&it, NULL, &value)) {
+                 Job *job = value;
+                 if (job->background && !job->stopped) return 0;
+             }
+         }
+     }
+     tab_wait_id[tab_index] = 0;
+     return 1;
+ }
+ 
+ /**
+  * @brief Sekme serbest kaldıkça sıraya alınmış komutları çalıştırır
+  * * Önce yarıda kalmış komut listesi sürdürülür; bu, listenin bir sonraki
+  * komutunun ön plandaki iş toplandığı anda (job_maybe_free'den) başlamasını
+  * sağlar.
+  * * @param tab_index Sekme
+  */
+ static void tab_run_pending(int tab_index) {
+     while (!tab_is_busy(tab_index)) {
+         if (tab_sequence[tab_index]) {
+             char *rest = tab_sequence[tab_index];
+             tab_sequence[tab_index] = NULL;
+             run_list(tab_index, rest, tab_sequence_op[tab_index]);
+             g_free(rest);
+             continue;
+         }
+         if (g_queue_is_empty(&tab_pending[tab_index])) break;
+         char *cmdline = g_queue_pop_head(&tab_pending[tab_index]);
+         execute_line(tab_index, cmdline);
+         free(cmdline);
+     }
+ }
+ 
+ /**
+  * @brief İşi durdurulmuş olarak işaretler
+  * * Ön plandaki iş durdurulursa sekme serbest kalır ve iş arka plana geçer.
+  * * @param job Durdurulan iş
+  */
+ static void job_mark_stopped(Job *job) {
+     int tab = job->tab_index;
+     job->stopped = 1;
+     job_set_process_status(job, 3);
+     if (tab_fg_job[tab] == job) {
+         tab_fg_job[tab] = NULL;
+         tab_last_status[tab] = 128 + SIGTSTP; // "a && b" durdurulan a'dan sonra b'yi çalıştırmaz
+         job->background = 1;
+         if (output_callback) {
+             char msg[320];
+             snprintf(msg, sizeof(msg), "\n[%d]+  Durduruldu\t%s\n", job->id, job->command);
+             output_callback(tab, msg, "orange");
+         }
+     }
+     tab_check_wait(tab);
+     tab_run_pending(tab);
+ }
+ 
+ /**
+  * @brief Çıktısı kapanmış ve tüm süreçleri toplanmış işi sonlandırır
+  * * İşin (son aşamanın) çıkış kodunu sekmeye kaydeder, işi tablodan çıkarır ve
+  * yapıyı serbest bırakır. Arka plan işleri için "Bitti" bildirimi yazılır; iş
+  * sekmeyi meşgul ediyorduysa sıradaki komutlar çalıştırılır. "parallel"
+  * girdileri çalıştırmalarına devredilir.
+  * * @param job Kontrol edilecek iş
+  */
+ static void job_maybe_free(Job *job) {
+     if (job->out_fd != -1 || job->err_fd != -1 || job->running != 0) return;
+     job_clear_deadline(job);
+     job_finish_capture(job);
+     if (job->parallel) {
+         parallel_job_done(job);
+     } else {
+         int tab = job->tab_index;
+         job_unregister(job);
+         if (tab < 0 || tab >= MAX_TABS) { // Sekmesi kapanmış iş: sonuç kimseye bildirilmez
+             if (job->subst) subst_free(job->subst);
+             g_free(job);
+             return;
+         }
+         tab_last_status[tab] = status_to_exit_code(job->last_status);
+ 
+         if (job->timed) job_report_time(job);
+         if (job->background && output_callback) {
+             char msg[320];
+             if (tab_last_status[tab] == 0) {
+                 snprintf(msg, sizeof(msg), "[%d]   Bitti\t\t%s\n", job->id, job->command);
+             } else if (job->last_status != -1 && WIFSIGNALED(job->last_status)) {
+                 snprintf(msg, sizeof(msg), "[%d]   %s\t%s\n", job->id,
+                          strsignal(WTERMSIG(job->last_status)), job->command);
+             } else {
+                 snprintf(msg, sizeof(msg), "[%d]   Çıkış %d\t%s\n", job->id, tab_last_status[tab], job->command);
+             }
+             output_callback(tab, msg, "lightblue");
+         } else if (tab_last_status[tab] != 0 && job->npids > 0 && !job->timed && !job->subst && output_callback) {
+             // Ön plandaki komutun başarısızlığı sekmede gösterilir (Ctrl+C ile kesilen hariç)
+             char msg[96] = "";
+             if (job->last_status != -1 && WIFSIGNALED(job->last_status)) {
+                 if (WTERMSIG(job->last_status) != SIGINT) {
+                     snprintf(msg, sizeof(msg), "[%s]\n", strsignal(WTERMSIG(job->last_status)));
+                 }
+             } else {
+                 snprintf(msg, sizeof(msg), "[Çıkış %d]\n", tab_last_status[tab]);
+             }
+             if (msg[0]) output_callback(tab, msg, "orange");
+         }
+         if (tab_fg_job[tab] == job) tab_fg_job[tab] = NULL;
+         struct Substitution *subst = job->subst;
+         int status = job->last_status;
+         g_free(job);
+ 
+         // Çıktısı toplanan komut bitti: dış komut sonuçla yeniden çalıştırılır
+         if (subst) subst_finish(tab, subst, status);
+         tab_check_wait(tab);
+         tab_run_pending(tab);
+     }
+ }
+ 
+ /**
+  * @brief Sekmede bitmemiş ön plan işi, yarıda kalmış komut listesi veya sırada
+  * bekleyen komut olup olmadığını söyler
+  * * Komutlar asenkron çalıştığı için model_execute_command döndüğünde komut
+  * bitmiş olmayabilir; çağıran bu fonksiyonla sonunu bekleyebilir. Arka plan
+  * işleri sekmeyi meşgul tutmaz ("wait" hariç).
+  * * @param tab_index Sekme
+  * @return int Süren komut varsa 1
+  */
+ int model_tab_busy(int tab_index) {
+     if (tab_index < 0 || tab_index >= MAX_TABS) return 0;
+     return tab_is_busy(tab_index) || tab_sequence[tab_index] != NULL ||
+            !g_queue_is_empty(&tab_pending[tab_index]);
+ }
+
+ /**
+  * @brief Sekmede en son tamamlanan işin çıkış kodunu döndürür
+  * * @param tab_index Sekme
+  * @return int 0-255 arası çıkış kodu (geçersiz sekme için 255)
+  */
+ int model_get_last_status(int tab_index) {
+     return tab_index >= 0 && tab_index < MAX_TABS ? tab_last_status[tab_index] : 255;
+ }
+ 
+ /**
+  * @brief Uzunluğu bilinen metni sekmeye iletir
+  * * output_callback NUL ile biten metin aldığından parça NUL baytlarında
+  * bölünür; NUL'lar (terminaldeki gibi) görünmez, sonrası kesilmez.
+  * * @param tab_index Hedef sekme
+  * @param data Metin (data[len] NUL olmalı)
+  * @param len Metnin uzunluğu
+  * @param color Renk (NULL = Controller belirlesin)
+  */
+ static void output_text(int tab_index, const char *data, size_t len, const char *color) {
+     if (!output_callback) return;
+     const char *end = data + len;
+     while (data < end) {
+         const char *nul = memchr(data, '\0', end - data);
+         if (nul != data) output_callback(tab_index, data, color);
+         if (!nul) break;
+         data = nul + 1;
+     }
+ }
+ 
+ /**
+  * @brief Sekmede gösterilecek çıktı parçasını iletir
+  * * @param job İlgili iş
+  * @param data NUL ile biten çıktı parçası
+  * @param len Parçanın uzunluğu
+  */
+ static void job_show_output(Job *job, const char *data, size_t len) {
+     if (job->parallel) {
+         parallel_output(job, data, len); // Satırlara girdinin öneki eklenir
+     } else {
+         output_text(job->tab_index, data, len, NULL); // Rengi Controller belirlesin
+     }
+ }
+ 
+ /**
+  * @brief Çıktı sekme penceresini ilk kez aştığında kullanıcıyı bilgilendirir
+  * * @param job İlgili iş
+  */
+ static void job_window_overflow(Job *job) {
+     if (job->overflowed) return;
+     job->overflowed = 1;
+     if (output_callback) {
+         output_callback(job->tab_index, job->capture_fd != -1
+                         ? "\n[Çıktı sekme penceresini aştı; devamı diske yazılıyor, sonu iş bitince gösterilecek...]\n"
+                         : "\n[Çıktı sekme penceresini aştı; devamı gösterilmiyor...]\n", "orange");
+     }
+ }
+ 
+ /**
+  * @brief Pencereyi aşan çıktının sonunu yakalama dosyasından okuyup sekmeye aktarır
+  * * Uzun bir çıktıda kullanıcının aradığı çoğunlukla sondadır (ör. derlemenin
+  * son hatası). Dosyaya aktarılan kısmın son OUTPUT_TAIL_BYTES baytı okunur;
+  * aradan bayt atlandıysa gösterim bir sonraki satır başından başlar. Çıktı
+  * pencereye en fazla OUTPUT_TAIL_BYTES kadar taştıysa hiçbir şey atlanmaz.
+  * * @param job Çıktısı EOF'a ulaşan iş
+  */
+ static void job_show_tail(Job *job) {
+     if (job->total_bytes <= MAX_OUTPUT_BYTES || job->capture_fd == -1) return;
+     size_t start = MAX_OUTPUT_BYTES;
+     if (job->total_bytes - start > OUTPUT_TAIL_BYTES) start = job->total_bytes - OUTPUT_TAIL_BYTES;
+     size_t len = job->total_bytes - start;
+ 
+     char *tail = g_malloc(len + 1);
+     size_t got = 0;
+     while (got < len) {
+         ssize_t n = pread(job->capture_fd, tail + got, len - got, start + got);
+         if (n == -1 && errno == EINTR) continue;
+         if (n <= 0) break;
+         got += n;
+     }
+     tail[got] = '\0';
+ 
+     size_t skip = 0;
+     if (start > MAX_OUTPUT_BYTES) {
+         char *nl = memchr(tail, '\n', got);
+         if (nl) skip = nl + 1 - tail;
+         if (output_callback) {
+             char size[32], msg[96];
+             format_size(start + skip - MAX_OUTPUT_BYTES, size, sizeof(size));
+             snprintf(msg, sizeof(msg), "\n[... %s atlandı; çıktının sonu:]\n", size);
+             output_callback(job->tab_index, msg, "orange");
+         }
+     }
+     if (got > skip) job_show_output(job, tail + skip, got - skip);
+     g_free(tail);
+ }
+ 
+ /**
+  * @brief Çıktı parçasını sekme penceresine ve gerekirse yakalama dosyasına ekler
+  * * Pencereye sığan kısım sekmeye aktarılır ve bellekte tutulur; pencere
+  * aşılınca yakalama dosyası açılır ve parça oraya yazılır. İşlerin ve süreç
+  * içi yerleşik komutların çıktısı bu yoldan geçer.
+  * * @param job İlgili iş
+  * @param data Parça (data[len] yazılabilir olmalı; gösterilen kısım NUL ile sonlandırılır)
+  * @param len Parçanın uzunluğu
+  * @return size_t Sekmeye aktarılan bayt sayısı
+  */
+ static size_t job_append_output(Job *job, char *data, size_t len) {
+     size_t before = job->total_bytes;
+     job->total_bytes += len;
+     if (job->total_bytes <= MAX_OUTPUT_BYTES) {
+         if (!job->head) job->head = g_string_sized_new(4096);
+         g_string_append_len(job->head, data, len); // Dosya gerekirse ilk kısım buradan yazılır
+     } else if (job_open_capture(job) && write_all(job->capture_fd, data, len) == -1) {
+         job_capture_failed(job, errno);
+     }
+ 
+     size_t shown = 0;
+     if (before < MAX_OUTPUT_BYTES) {
+         shown = job->total_bytes <= MAX_OUTPUT_BYTES ? len : MAX_OUTPUT_BYTES - before;
+         data[shown] = '\0';
+         job_show_output(job, data, shown);
+     }
+     if (shown < len) job_window_overflow(job);
+     return shown;
+ }
+ 
+ /**
+  * @brief İşin çıktı pipe'ında veri olduğunda ana döngü tarafından çağrılır
+  * * İlk MAX_OUTPUT_BYTES baytı sekmeye aktarır ve bellekte tutar; pencere
+  * aşılınca yakalama dosyası açılır ve çıktı oraya yazılır. EOF'ta pencereyi aşan kısmın sonu job_show_tail ile
+  * gösterilir. Pencere dolduktan sonra veri splice ile kullanıcı alanına hiç
+  * kopyalanmadan doğrudan dosyaya aktarılır. Tek olayda en fazla
+  * OUTPUT_READ_BUDGET (dosyaya aktarırken SPILL_BUDGET) bayt işlenir; pipe
+  * boşaldığında ana döngüye dönülür. Çocuk süreç çıktı miktarı yüzünden
+  * sonlandırılmaz: dosyaya yazma yavaşlarsa okuma da yavaşlar, pipe dolar ve
+  * çocuk yazarken bekler. EOF'ta pipe kapatılır.
+  * * @param fd Pipe'ın okuma ucu
+  * @param condition Tetiklenen olay
+  * @param user_data İlgili Job
+  * @return gboolean Pipe açık kaldıkça G_SOURCE_CONTINUE
+  */
+ static gboolean on_job_output(gint fd, GIOCondition condition, gpointer user_data) {
+     Job *job = user_data;
+     char buffer[4096];
+     size_t budget = 0;
+     size_t spilled = 0;
+     int eof = 0;
+ 
+     while (budget < OUTPUT_READ_BUDGET && spilled < SPILL_BUDGET) {
+         if (job->total_bytes >= MAX_OUTPUT_BYTES && job->capture_fd != -1 && !job->no_splice) {
+             ssize_t n = splice(fd, NULL, job->capture_fd, NULL, SPILL_CHUNK,
+                                SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+             if (n > 0) {
+                 job_window_overflow(job);
+                 job->total_bytes += n;
+                 spilled += n;
+                 continue;
+             }
+             if (n == 0) { eof = 1; break; }
+             if (errno == EINTR) continue;
+             if (errno == EAGAIN) return G_SOURCE_CONTINUE; // Şimdilik veri yok
+             if (errno == EINVAL) job->no_splice = 1; // PTY: okuma/yazma ile devam
+             else job_capture_failed(job, errno);
+             continue;
+         }
+ 
+         ssize_t n = read(fd, buffer, sizeof(buffer) - 1);
+         if (n == -1 && errno == EINTR) continue;
+         if (n == -1 && errno == EAGAIN) return G_SOURCE_CONTINUE; // Şimdilik veri yok
+         if (n <= 0) { eof = 1; break; } // EOF (tüm yazıcılar kapandı), PTY'de EIO veya okuma hatası
+ 
+         if (!job->got_output) {
+             // Başlatmadan ilk bayta kadar geçen süreyi kipe göre kaydet
+             FirstByteStats *fb = &first_byte_stats[job->out_mode];
+             gint64 elapsed = g_get_monotonic_time() - job->start_us;
+             if (fb->count == 0 || elapsed < fb->min_us) fb->min_us = elapsed;
+             if (elapsed > fb->max_us) fb->max_us = elapsed;
+             fb->last_us = elapsed;
+             fb->total_us += elapsed;
+             fb->count++;
+             job->got_output = 1;
+         }
+ 
+         if (job->subst) {
+             subst_append(job->subst, buffer, n); // Sekmeye değil belleğe
+             budget += n;
+             continue;
+         }
+ 
+         size_t shown = job_append_output(job, buffer, n);
+         budget += shown;
+         spilled += n - shown;
+     }
+     if (!eof) {
+         return G_SOURCE_CONTINUE; // Bütçe doldu, kalan veri bir sonraki turda
+     }
+ 
+     job_show_tail(job);
+     close(fd);
+     job->out_fd = -1;
+     job->out_watch = 0;
+     job_maybe_free(job);
+     return G_SOURCE_REMOVE;
+ }
+ 
+ /**
+  * @brief Komut yerine koyma işinin stderr'ini sekmeye (kırmızı) aktarır
+  * * stdout belleğe toplanırken hata mesajları kaybolmasın diye ayrı bir pipe'tan
+  * okunur. EOF'ta pipe kapatılır.
+  */
+ static gboolean on_job_errors(gint fd, GIOCondition condition, gpointer user_data) {
+     Job *job = user_data;
+     char buffer[4096];
+     size_t budget = 0;
+     while (budget < OUTPUT_READ_BUDGET) {
+         ssize_t n = read(fd, buffer, sizeof(buffer) - 1);
+         if (n == -1 && errno == EINTR) continue;
+         if (n == -1 && errno == EAGAIN) return G_SOURCE_CONTINUE;
+         if (n <= 0) {
+             close(fd);
+             job->err_fd = -1;
+             job->err_watch = 0;
+             job_maybe_free(job);
+             return G_SOURCE_REMOVE;
+         }
+         buffer[n] = '\0';
+         if (output_callback) output_callback(job->tab_index, buffer, "red");
+         budget += n;
+     }
+     return G_SOURCE_CONTINUE;
+ }
+ 
+ /**
+  * @brief Çocuk süreç sonlandığında (toplandıktan sonra) launcher tarafından çağrılır
+  * * Çıkış kodu ve kaynak kullanımı process tablosuna yazılır ve işin toplamına
+  * eklenir (CPU süreleri ve sayfa hataları toplanır, bellekte en yüksek alınır).
+  * * @param pid Sonlanan süreç
+  * @param status waitpid durum değeri (-1 = bilinmiyor)
+  * @param usage wait4 ile toplanan kaynak kullanımı (NULL = bilinmiyor)
+  * @param user_data İlgili Job
+  */
+ static void on_job_exited(pid_t pid, int status, const LaunchUsage *usage, void *user_data) {
+     Job *job = user_data;
+     gint64 end_us = usage ? (gint64)(usage->exit_ns / 1000) : g_get_monotonic_time();
+     if (usage) {
+         job->user_us += usage->user_us;
+         job->sys_us += usage->sys_us;
+         if (usage->max_rss_kb > job->max_rss_kb) job->max_rss_kb = usage->max_rss_kb;
+         job->major_faults += usage->major_faults;
+     }
+     for (int i = 0; i < job->npids; i++) {
+         if (job->pids[i] != pid) continue;
+         ProcessInfo *proc = process_get(job->procs[i]);
+         if (proc && (proc->status == 0 || proc->status == 3)) {
+             proc->end_us = end_us;
+             proc->exit_code = status_to_exit_code(status);
+             if (usage) {
+                 proc->has_usage = 1;
+                 proc->user_us = usage->user_us;
+                 proc->sys_us = usage->sys_us;
+                 proc->max_rss_kb = usage->max_rss_kb;
+                 proc->major_faults = usage->major_faults;
+             }
+             process_set_status(proc, status != -1 && WIFSIGNALED(status) ? 2 : 1); // killed / completed
+         }
+         break;
+     }
+     if (pid == job->last_pid) {
+         job->last_status = status;
+     }
+     job->running--;
+     if (job->running == 0) job->end_us = end_us;
+     job_maybe_free(job);
+ }
+ 
+ /**
+  * @brief Süreç başlatma sürelerini gösteren "spawnstat" komutu
+  * * @param tab_index Çıktının yazılacağı sekme
+  */
+ static void show_spawn_stats(int tab_index) {
+     const LaunchStats *st = launcher_get_stats();
+     char buffer[512];
+     if (st->count == 0) {
+         snprintf(buffer, sizeof(buffer), "Henüz süreç başlatılmadı (yardımcı PID: %d)\n",
+                  launcher_helper_pid());
+     } else {
+         snprintf(buffer, sizeof(buffer),
+                  "Yardımcı PID: %d\n"
+                  "Başlatma: %lu (yardımcı ile: %lu)\n"
+                  "Süre (µs): son %.1f, min %.1f, ort %.1f, maks %.1f\n"
+                  "GUI gidiş-dönüş ort (µs): %.1f\n",
+                  launcher_helper_pid(), st->count, st->via_helper,
+                  st->last_ns / 1000.0, st->min_ns / 1000.0,
+                  st->total_ns / 1000.0 / st->count, st->max_ns / 1000.0,
+                  st->total_rtt_ns / 1000.0 / st->count);
+     }
+     if (output_callback) output_callback(tab_index, buffer, "lightgreen");
+ }
+ 
+ /**
+  * @brief Çıktı yakalama için bir sözde terminal (PTY) çifti açar
+  * * Çocuklar stdout'un bir terminal olduğunu gördüğünde libc satır tamponlamaya
+  * geçer; böylece çıktı 4 KiB'lık yığınlar yerine satır satır gelir. Çıkış
+  * işlemesi (OPOST) kapatılır ki "\n" "\r\n"ye dönüşmesin. Çocuklar PTY'yi
+  * denetim terminali olarak almaz; iş denetimi süreç grubu üzerinden yürür.
+  * * @param master Ana ucun yazılacağı yer (GUI okur)
+  * @param slave Bağımlı ucun yazılacağı yer (çocuklara verilir)
+  * @return int Başarılıysa 0, hata durumunda -1
+  */
+ static int open_output_pty(int *master, int *slave) {
+     int m = posix_openpt(O_RDWR | O_NOCTTY | O_CLOEXEC);
+     if (m == -1) return -1;
+     if (grantpt(m) == -1 || unlockpt(m) == -1) {
+         close(m);
+         return -1;
+     }
+     char name[64];
+     if (ptsname_r(m, name, sizeof(name)) != 0) {
+         close(m);
+         return -1;
+     }
+     int s = open(name, O_RDWR | O_NOCTTY | O_CLOEXEC);
+     if (s == -1) {
+         close(m);
+         return -1;
+     }
+ 
+     struct termios tio;
+     if (tcgetattr(s, &tio) == 0) {
+         tio.c_oflag &= ~OPOST;
+         tio.c_lflag &= ~(ECHO | ICANON);
+         tcsetattr(s, TCSANOW, &tio);
+     }
+     struct winsize ws = { .ws_row = 24, .ws_col = 80 };
+     ioctl(s, TIOCSWINSZ, &ws);
+ 
+     *master = m;
+     *slave = s;
+     return 0;
+ }
+ 
+ /**
+  * @brief Sekmenin çıktı kipini gösteren / değiştiren "outmode" komutu
+  * * "outmode" geçerli kipi ve iki kipin ilk bayt sürelerini gösterir;
+  * "outmode pipe" ve "outmode pty" sekmenin kipini değiştirir.
+  * * @param tab_index Komutun çalıştırıldığı sekme
+  * @param args Komut adından sonraki kısım
+  */
+ static void show_out_mode(int tab_index, const char *args) {
+     if (tab_index < 0 || tab_index >= MAX_TABS) return;
+     while (*args && isspace((unsigned char)*args)) args++;
+ 
+     char buffer[768];
+     if (*args) {
+         if (strcmp(args, "pipe") == 0) {
+             tab_out_mode[tab_index] = OUT_MODE_PIPE;
+         } else if (strcmp(args, "pty") == 0) {
+             tab_out_mode[tab_index] = OUT_MODE_PTY;
+         } else {
+             command_error(tab_index, "Kullanım: outmode [pipe|pty]\n");
+             return;
+         }
+         snprintf(buffer, sizeof(buffer), "Çıktı kipi: %s\n", out_mode_names[tab_out_mode[tab_index]]);
+         if (output_callback) output_callback(tab_index, buffer, "lightgreen");
+         return;
+     }
+ 
+     size_t len = snprintf(buffer, sizeof(buffer), "Çıktı kipi: %s\nİlk bayt süresi (ms):\n",
+                           out_mode_names[tab_out_mode[tab_index]]);
+     for (int mode = OUT_MODE_PIPE; mode <= OUT_MODE_PTY; mode++) {
+         const FirstByteStats *fb = &first_byte_stats[mode];
+         if (fb->count == 0) {
+             len += snprintf(buffer + len, sizeof(buffer) - len, "  %-4s  ölçüm yok\n", out_mode_names[mode]);
+         } else {
+             len += snprintf(buffer + len, sizeof(buffer) - len,
+                             "  %-4s  %lu ölçüm: son %.2f, min %.2f, ort %.2f, maks %.2f\n",
+                             out_mode_names[mode], fb->count, fb->last_us / 1000.0,
+                             fb->min_us / 1000.0, fb->total_us / 1000.0 / fb->count,
+                             fb->max_us / 1000.0);
+         }
+     }
+     if (output_callback) output_callback(tab_index, buffer, "lightgreen");
+ }
+ 
+ /**
+  * @brief Belirteçleri tırnaksız '|' işleçlerinden boru hattı aşamalarına böler
+  * * @param tokens Belirteçler ('|' konumlarına NULL yazılır)
+  * @param stages Aşamaların argv'lerinin yazılacağı dizi
+  * @param stage_flags Aşamaların belirteç bayraklarının yazılacağı dizi
+  * @param max_stages Dizinin kapasitesi
+  * @return int Aşama sayısı veya çok fazla aşama varsa -1
+  */
+ static int split_pipeline(TokenList *tokens, char **stages[], const unsigned char *stage_flags[], int max_stages) {
+     int count = 0;
+     int start = 0;
+     for (int i = 0; i <= tokens->argc; i++) {
+         if (i < tokens->argc && !((tokens->flags[i] & TOKEN_OP) && strcmp(tokens->argv[i], "|") == 0)) continue;
+         if (count == max_stages) return -1;
+         tokens->argv[i] = NULL; // Aşamanın argv'si burada biter
+         stages[count] = &tokens->argv[start];
+         stage_flags[count] = &tokens->flags[start];
+         count++;
+         start = i + 1;
+     }
+     return count;
+ }
+ 
+ /**
+  * @brief argv'yi process tablosunda gösterilecek tek satıra birleştirir
+  * * @param argv NULL ile biten argüman dizisi
+  * @param out Çıktı tamponu
+  * @param size Tampon boyutu
+  */
+ static void join_argv(char *const argv[], char *out, size_t size) {
+     size_t len = 0;
+     out[0] = '\0';
+     for (int i = 0; argv[i] && len + 1 < size; i++) {
+         len += snprintf(out + len, size - len, i ? " %s" : "%s", argv[i]);
+     }
+ }
+ 
+ /**
+  * @brief argv'den yönlendirme işleçlerini (<, >, >>, N>, N>>, &>, &>>, N>&M) ayıklar
+  * * İşleçler tokenize tarafından ayrı belirteç yapıldığı için hem "> dosya" hem
+  * de ">dosya" aynı şekilde gelir; tırnaklı ">" ise sıradan argümandır.
+  * Yönlendirmeler yazıldıkları sırayla uygulanır; böylece "> log 2>&1" ile
+  * "2>&1 > log" farklı sonuç verir. Ayıklanan belirteçler argv'den çıkarılır.
+  * * @param argv NULL ile biten argüman dizisi (yerinde sıkıştırılır)
+  * @param flags Belirteçlerin TOKEN_* bayrakları
+  * @param redirects Sonuçların yazılacağı dizi
+  * @param max_redirects Dizinin kapasitesi
+  * @param bad Sözdizimi hatasında sorunlu belirteç yazılır
+  * @return int Yönlendirme sayısı veya sözdizimi hatasında -1
+  */
+ static int extract_redirects(char *argv[], const unsigned char *flags, LaunchRedirect *redirects,
+                              int max_redirects, const char **bad) {
+     int count = 0;
+     int out = 0;
+     for (int i = 0; argv[i]; i++) {
+         if (!(flags[i] & TOKEN_OP)) {
+             argv[out++] = argv[i]; // Sıradan argüman
+             continue;
+         }
+ 
+         const char *op = argv[i];
+         int fd = -1;
+         int both = 0; // &> : stdout ve stderr birlikte
+         *bad = argv[i];
+         if (isdigit((unsigned char)op[0])) {
+             fd = op[0] - '0';
+             op++;
+         } else if (op[0] == '&' && op[1] == '>') {
+             both = 1;
+             op++;
+         }
+ 
+         int mode;
+         if (op[0] == '<') {
+             mode = O_RDONLY;
+             if (fd == -1) fd = STDIN_FILENO;
+             op++;
+         } else if (op[0] == '>' && op[1] == '>') {
+             mode = O_WRONLY | O_CREAT | O_APPEND;
+             if (fd == -1) fd = STDOUT_FILENO;
+             op += 2;
+         } else if (op[0] == '>') {
+             mode = O_WRONLY | O_CREAT | O_TRUNC;
+             if (fd == -1) fd = STDOUT_FILENO;
+             op++;
+         } else {
+             return -1; // Burada '|' veya '&' olamaz
+         }
+         if (fd > STDERR_FILENO || count + (both ? 2 : 1) > max_redirects) return -1;
+ 
+         if (*op == '&') { // N>&M: fd kopyalama
+             redirects[count++] = (LaunchRedirect){ .fd = fd, .dup_from = op[1] - '0' };
+             continue;
+         }
+ 
+         if (!argv[i + 1] || (flags[i + 1] & TOKEN_OP)) return -1; // Dosya adı eksik
+         const char *path = argv[++i];
+         redirects[count++] = (LaunchRedirect){ .fd = fd, .flags = mode, .path = path, .dup_from = -1 };
+         if (both) {
+             redirects[count++] = (LaunchRedirect){ .fd = STDERR_FILENO, .dup_from = STDOUT_FILENO };
+         }
+     }
+     argv[out] = NULL;
+     return count;
+ }
+ 
+ /**
+  * @brief Başlatma hatasını sekmeye yazar
+  * * @param tab_index Hedef sekme
+  * @param spec Başlatılamayan komutun tanımı
+  * @param error Launcher'ın döndürdüğü hata
+  */
+ static void report_spawn_error(int tab_index, const LaunchSpec *spec, const LaunchError *error) {
+     if (!output_callback) return;
+     char msg[512];
+     if (error->redirect >= 0 && error->redirect < spec->nredirects &&
+         spec->redirects[error->redirect].path) {
+         snprintf(msg, sizeof(msg), "%s: %s\n", spec->redirects[error->redirect].path, strerror(error->code));
+     } else if (error->code == ENOENT) {
+         snprintf(msg, sizeof(msg), "Komut bulunamadı: %s\n", spec->argv[0]);
+     } else {
+         snprintf(msg, sizeof(msg), "[Hata: Süreç oluşturulamadı: %s: %s]\n", spec->argv[0], strerror(error->code));
+     }
+     output_callback(tab_index, msg, "red");
+ }
+ 
+ /**
+  * @brief Bir boru hattını (tek komut dahil) başlatır
+  * * Her aşama ayrı bir süreçtir ve hepsi ilk aşamanın süreç grubuna katılır.
+  * Aşamalar arasındaki pipe'lar yalnızca çocuklarda açık kalır; ara veri bu
+  * süreçten hiç geçmez. Yalnızca son aşamanın stdout'u ile tüm stderr'ler
+  * sekmeye okunur. Dosya yönlendirmeleri çocukta açılır, yani yönlendirilen
+  * çıktı da bu süreçten geçmez. Fonksiyon süreçleri beklemeden döner.
+  * * @param tab_index Komutun çalıştırılacağı sekme
+  * @param cmdline Çalıştırılacak komut satırı
+  * @param parallel İş bir "parallel" girdisiyse çalıştırması (iş tablosuna eklenmez), değilse NULL
+  * @param limits Komuta özel sınırlar (NULL = sekmenin varsayılanları)
+  * @param subst Komut yerine koyma işiyse stdout'un toplanacağı yer: çıktı her
+  *              zaman pipe'tan okunur, diske yazılmaz ve stderr ayrı pipe'tan gelir
+  * @return Job* Başlatılan iş veya hata durumunda NULL
+  */
+ static Job* run_pipeline(int tab_index, const char *cmdline, ParallelRun *parallel, const JobLimits *limits,
+                          struct Substitution *subst) {
+     TokenList tokens; // argv'ler ve yönlendirme yolları bu arenayı gösterir
+     const char *error;
+     char msg[320];
+     if (tokenize(cmdline, tab_index, &tokens, &error) == -1) {
+         snprintf(msg, sizeof(msg), "Sözdizimi hatası: %s\n", error);
+         if (output_callback) output_callback(tab_index, msg, "red");
+         return NULL;
+     }
+ 
+     char **stage_argv[MAX_PIPELINE];
+     const unsigned char *stage_flags[MAX_PIPELINE];
+     LaunchRedirect stage_redirects[MAX_PIPELINE][MAX_REDIRECTS];
+     int stage_nredirects[MAX_PIPELINE];
+     char **stage_assigns[MAX_PIPELINE];
+     int stage_nassigns[MAX_PIPELINE];
+     int nstages = split_pipeline(&tokens, stage_argv, stage_flags, MAX_PIPELINE);
+     if (nstages < 0) {
+         if (output_callback) output_callback(tab_index, "[Hata: Boru hattında çok fazla aşama var]\n", "red");
+         token_list_free(&tokens);
+         return NULL;
+     }
+     for (int i = 0; i < nstages; i++) {
+         // Baştaki "AD=değer" sözcükleri yalnızca bu aşamanın ortamına girer
+         stage_assigns[i] = stage_argv[i];
+         stage_nassigns[i] = 0;
+         while (stage_argv[i][0] && (stage_flags[i][0] & TOKEN_ASSIGN)) {
+             stage_argv[i]++;
+             stage_flags[i]++;
+             stage_nassigns[i]++;
+         }
+ 
+         const char *bad = NULL;
+         stage_nredirects[i] = extract_redirects(stage_argv[i], stage_flags[i], stage_redirects[i],
+                                                 MAX_REDIRECTS, &bad);
+         if (stage_nredirects[i] < 0) {
+             snprintf(msg, sizeof(msg), "Sözdizimi hatası: '%s' yakınında\n", bad);
+         } else if (stage_argv[i][0] == NULL) {
+             snprintf(msg, sizeof(msg), "Sözdizimi hatası: '|' yakınında boş komut\n");
+         } else {
+             continue;
+         }
+         if (output_callback) output_callback(tab_index, msg, "red");
+         token_list_free(&tokens);
+         return NULL;
+     }
+ 
+     // Pipe veya PTY oluştur (çıktıları yakalamak için). O_CLOEXEC: aynı anda çalışan
+     // diğer komutlar bu uçları miras almasın, yoksa EOF gecikir.
+     int out_mode = (tab_index >= 0 && tab_index < MAX_TABS && !subst) ? tab_out_mode[tab_index] : OUT_MODE_PIPE;
+     int pipefd[2] = { -1, -1 };
+     if (out_mode == OUT_MODE_PTY && open_output_pty(&pipefd[0], &pipefd[1]) == -1) {
+         perror("posix_openpt failed");
+         if (output_callback) output_callback(tab_index, "[Uyarı: PTY açılamadı, pipe kullanılıyor]\n", "orange");
+         out_mode = OUT_MODE_PIPE;
+     }
+     int errfd[2] = { -1, -1 };
+     if ((out_mode == OUT_MODE_PIPE && pipe2(pipefd, O_CLOEXEC) == -1) ||
+         (subst && pipe2(errfd, O_CLOEXEC) == -1)) {
+         perror("pipe failed");
+         if (output_callback) output_callback(tab_index, "[Hata: Pipe oluşturulamadı]\n", "red");
+         // Yalnızca açılabilmiş uçlar kapatılır (pipe2 hata durumunda diziye yazmaz)
+         for (int i = 0; i < 2; i++) {
+             if (pipefd[i] != -1) close(pipefd[i]);
+             if (errfd[i] != -1) close(errfd[i]);
+         }
+         token_list_free(&tokens);
+         return NULL;
+     }
+ 
+     // Komuta özel sınır verilmediyse sekmenin varsayılanları uygulanır
+     if (!limits && tab_index >= 0 && tab_index < MAX_TABS) limits = &tab_limits[tab_index];
+     LaunchLimit launch_limits[3];
+     int nlimits = limits ? job_limits_to_launch(limits, launch_limits) : 0;
+     guint64 env_id;
+     char *const *envp = tab_env(tab_index, &env_id);
+     const char *search_path = var_lookup(tab_index, "PATH", 4);
+ 
+     Job *job = g_new0(Job, 1);
+     job->tab_index = tab_index;
+     job->parallel = parallel;
+     if (!parallel) job_register(job);
+     g_strlcpy(job->command, cmdline, sizeof(job->command));
+     job->out_fd = pipefd[0];
+     job->err_fd = errfd[0];
+     job->subst = subst;
+     job->capture_fd = -1; // Çıktı pencereyi aşarsa job_open_capture ile açılır
+     job->out_mode = out_mode;
+     job->start_us = g_get_monotonic_time();
+     job->last_pid = -1;
+     job->last_status = W_EXITCODE(127, 0); // Son aşama başlatılamazsa
+ 
+     int prev_read = -1; // Önceki aşamanın çıktısı (bu aşamanın stdin'i)
+     for (int i = 0; i < nstages; i++) {
+         int last = (i == nstages - 1);
+         int link[2] = { -1, -1 };
+         if (!last && pipe2(link, O_CLOEXEC) == -1) {
+             if (output_callback) output_callback(tab_index, "[Hata: Pipe oluşturulamadı]\n", "red");
+             break;
+         }
+ 
+         char **stage_envp = NULL;
+         const char *stage_path = search_path;
+         if (stage_nassigns[i]) {
+             stage_envp = env_with_assignments(tab_index, stage_assigns[i], stage_nassigns[i]);
+             for (int k = 0; k < stage_nassigns[i]; k++) {
+                 if (strncmp(stage_assigns[i][k], "PATH=", 5) == 0) stage_path = stage_assigns[i][k] + 5;
+             }
+         }
+         LaunchSpec spec = {
+             .argv = stage_argv[i],
+             .path = path_resolve(stage_argv[i][0], stage_path, tab_dir_at(tab_index)),
+             .stdin_fd = prev_read,
+             .stdout_fd = last ? pipefd[1] : link[1],
+             .stderr_fd = subst ? errfd[1] : pipefd[1],
+             .pgid = job->pgid, // 0: ilk aşama yeni grup kurar
+             .cwd_fd = tab_dir_fd(tab_index),
+             .redirects = stage_redirects[i],
+             .nredirects = stage_nredirects[i],
+             .limits = launch_limits,
+             .nlimits = nlimits,
+             .envp = stage_envp ? stage_envp : envp,
+             .env_id = stage_envp ? 0 : env_id, // Tek seferlik ortam yardımcıda saklanmaz
+         };
+         LaunchError spawn_error = { ENOENT, -1 };
+         pid_t pid = -1;
+         gint64 stage_start = g_get_monotonic_time();
+         if (spec.path) { // PATH'te bulunamayan komut için süreç başlatılmaz
+             pid = launcher_spawn(&spec, on_job_exited, job, &spawn_error);
+         }
+         g_free(stage_envp);
+         if (pid == -1) {
+             report_spawn_error(tab_index, &spec, &spawn_error);
+             if (last && (spawn_error.code != ENOENT || spawn_error.redirect >= 0)) {
+                 job->last_status = W_EXITCODE(spawn_error.redirect >= 0 ? 1 : 126, 0);
+             }
+         } else {
+             if (job->pgid == 0) {
+                 job->pgid = pid;
+             } else {
+                 // Önceki aşamalar çoktan bitip toplandıysa launcher yeni grup kurmuş olabilir
+                 pid_t actual = getpgid(pid);
+                 if (actual > 0) job->pgid = actual;
+             }
+             if (last) job->last_pid = pid;
+             job->running++;
+ 
+             char label[256];
+             join_argv(stage_argv[i], label, sizeof(label));
+             job->procs[job->npids] = add_process(pid, label, tab_index);
+             ProcessInfo *proc = process_get(job->procs[job->npids]);
+             if (proc) proc->start_us = stage_start; // Başlatma süresi de duvar saatine dahil
+             job->pids[job->npids++] = pid;
+         }
+ 
+         // Aşamalar arası uçlar artık yalnızca çocuklarda açık olmalı
+         if (prev_read != -1) close(prev_read);
+         if (link[1] != -1) close(link[1]);
+         prev_read = link[0];
+     }
+     if (prev_read != -1) close(prev_read);
+     token_list_free(&tokens); // argv çocuklara kopyalandı, artık gereksiz
+ 
+     // ------- Ana (Parent) süreç -------
+     close(pipefd[1]);  // Yazma ucunu (PTY'de bağımlı ucu) kapat
+     if (subst) {
+         close(errfd[1]);
+         fcntl(errfd[0], F_SETFL, fcntl(errfd[0], F_GETFL) | O_NONBLOCK);
+         job->err_watch = g_unix_fd_add(errfd[0], G_IO_IN | G_IO_HUP | G_IO_ERR, on_job_errors, job);
+     }
+ 
+     // Okuma ucu bloklamasın: veri bitince read() EAGAIN döner ve ana döngüye dönülür
+     fcntl(pipefd[0], F_SETFL, fcntl(pipefd[0], F_GETFL) | O_NONBLOCK);
+ 
+     // Çıktıyı ana döngüye bağla; süreç sonları on_job_exited ile bildirilir
+     job->out_watch = g_unix_fd_add(pipefd[0], G_IO_IN | G_IO_HUP | G_IO_ERR, on_job_output, job);
+     if (limits && limits->timeout_us && job->pgid > 0) job_set_deadline(job, job->start_us + limits->timeout_us);
+     return job;
+ }
+ 
+ // ------------------- parallel -------------------
+ 
+ #define MAX_PARALLEL_WORKERS 256 // "parallel -j" üst sınırı
+ #define PARALLEL_PREFIX_LEN 24   // Çıktı önekinde gösterilecek en fazla girdi uzunluğu
+ #define PARALLEL_LINE_MAX 4096   // Satır sonu gelmese de bu uzunlukta yarım satır yazılır
+ 
+ /**
+  * @brief Bir "parallel" girdisinin çıktı satırını girdinin önekiyle yazar
+  * * @param job Satırı üreten iş
+  * @param line NUL ile biten satır
+  */
+ static void parallel_emit_line(Job *job, const char *line) {
+     if (!output_callback) return;
+     const char *arg = g_ptr_array_index(job->parallel->args, job->parallel_item);
+     char prefix[PARALLEL_PREFIX_LEN + 8];
+     snprintf(prefix, sizeof(prefix), "[%.*s] ", PARALLEL_PREFIX_LEN, arg);
+     output_callback(job->tab_index, prefix, "gold");
+     output_callback(job->tab_index, line, NULL);
+ }
+ 
+ /**
+  * @brief "parallel" girdisinin çıktısını satırlara bölüp önekli olarak yazar
+  * * Aynı anda çalışan işlerin çıktıları satır ortasında karışmasın diye yalnızca
+  * tam satırlar yazılır; yarım satır bir sonraki okumayı bekler.
+  * * @param job Çıktıyı üreten iş
+  * @param data Okunan veri
+  * @param len Veri uzunluğu
+  */
+ static void parallel_output(Job *job, const char *data, size_t len) {
+     if (!job->line_buf) job->line_buf = g_string_new(NULL);
+     GString *buf = job->line_buf;
+     g_string_append_len(buf, data, len);
+ 
+     size_t start = 0;
+     for (size_t i = 0; i < buf->len; i++) {
+         if (buf->str[i] != '\n' && i + 1 - start < PARALLEL_LINE_MAX) continue;
+         char saved = buf->str[i + 1];
+         buf->str[i + 1] = '\0';
+         parallel_emit_line(job, buf->str + start);
+         buf->str[i + 1] = saved;
+         start = i + 1;
+     }
+     g_string_erase(buf, 0, start);
+ }
+ 
+ /**
+  * @brief Şablon kelimesini tırnaklayarak ekler; "{}" yer tutucuları tırnak dışında kalır
+  * * "[{}].txt" gibi bir kelime '['{}'].txt' olur; yer tutucuya tırnaklanmış girdi
+  * konunca parçalar yine tek argüman olarak okunur.
+  * * @param template Şablon
+  * @param word Ayrıştırılmış kelime
+  */
+ static void parallel_append_word(GString *template, const char *word) {
+     if (*word == '\0') {
+         g_string_append(template, "''");
+         return;
+     }
+     const char *hole;
+     while ((hole = strstr(word, "{}")) != NULL) {
+         if (hole > word) {
+             char *piece = g_strndup(word, hole - word);
+             append_quoted(template, piece);
+             g_free(piece);
+         }
+         g_string_append(template, "{}");
+         word = hole + 2;
+     }
+     if (*word) append_quoted(template, word);
+ }
+ 
+ /**
+  * @brief "{}" yer tutucularını girdiyle değiştirerek komut satırını üretir
+  * * Şablonda "{}" yoksa girdi sona eklenir. Girdi tırnaklanır; boşluk veya özel
+  * karakter içerse de komuta tek argüman olarak geçer.
+  * * @param template Komut şablonu
+  * @param arg Girdi
+  * @return char* Yeni komut satırı (g_free ile serbest bırakılmalı)
+  */
+ static char* parallel_build_command(const char *template, const char *arg) {
+     GString *cmd = g_string_new(NULL);
+     const char *p = template;
+     const char *hole;
+     int replaced = 0;
+     while ((hole = strstr(p, "{}")) != NULL) {
+         g_string_append_len(cmd, p, hole - p);
+         append_quoted(cmd, arg);
+         p = hole + 2;
+         replaced = 1;
+     }
+     g_string_append(cmd, p);
+     if (!replaced) {
+         g_string_append_c(cmd, ' ');
+         append_quoted(cmd, arg);
+     }
+     return g_string_free(cmd, FALSE);
+ }
+ 
+ /**
+  * @brief Çalıştırma bittiğinde özet yazar ve kaynakları serbest bırakır
+  * * Çıkış kodu, başarısız iş sayısıdır (en fazla 101, GNU parallel'deki gibi).
+  * * @param run Biten çalıştırma
+  */
+ static void parallel_finish(ParallelRun *run) {
+     int tab = run->tab_index;
+     gint64 wall = g_get_monotonic_time() - run->start_us;
+     guint skipped = run->args->len - run->finished;
+ 
+     if (output_callback) {
+         char msg[512];
+         size_t len = snprintf(msg, sizeof(msg),
+                               "[parallel] %u iş, %d başarısız, %d işçi; toplam süre %.3f s",
+                               run->finished, run->failed, run->max_workers, wall / 1e6);
+         if (run->finished > 0) {
+             len += snprintf(msg + len, sizeof(msg) - len,
+                             " (iş süreleri toplamı %.3f s, %.2fx); iş süresi min %.3f / ort %.3f / maks %.3f s",
+                             run->job_total_us / 1e6,
+                             wall > 0 ? (double)run->job_total_us / wall : 0.0,
+                             run->job_min_us / 1e6, run->job_total_us / 1e6 / run->finished,
+                             run->job_max_us / 1e6);
+         }
+         if (skipped > 0) {
+             len += snprintf(msg + len, sizeof(msg) - len, "; %u girdi iptal edildi", skipped);
+         }
+         snprintf(msg + len, sizeof(msg) - len, "\n");
+         output_callback(tab, msg, run->failed || skipped ? "orange" : "lightgreen");
+     }
+ 
+     int released = 0;
+     if (tab >= 0 && tab < MAX_TABS) {
+         tab_last_status[tab] = run->failed > 101 ? 101 : run->failed;
+         if (tab_fg_parallel[tab] == run) {
+             tab_fg_parallel[tab] = NULL;
+             released = 1;
+         }
+     }
+     parallel_runs = g_list_remove(parallel_runs, run);
+     g_ptr_array_free(run->args, TRUE);
+     g_free(run->workers);
+     g_free(run->template);
+     g_free(run);
+ 
+     if (released) tab_run_pending(tab);
+ }
+ 
+ /**
+  * @brief Boş işçi yuvalarını sıradaki girdilerle doldurur
+  * * Girdiler bitmiş ve çalışan iş kalmamışsa çalıştırmayı sonlandırır.
+  * * @param run Çalıştırma
+  */
+ static void parallel_fill(ParallelRun *run) {
+     while (run->running < run->max_workers && run->next < run->args->len) {
+         guint item = run->next++;
+         char *cmdline = parallel_build_command(run->template, g_ptr_array_index(run->args, item));
+         Job *job = run_pipeline(run->tab_index, cmdline, run, NULL, NULL);
+         g_free(cmdline);
+         if (!job) { // Ayrıştırma veya pipe hatası (mesaj yazıldı)
+             run->failed++;
+             run->finished++;
+             continue;
+         }
+         job->parallel_item = item;
+         for (int slot = 0; slot < run->max_workers; slot++) {
+             if (!run->workers[slot]) {
+                 run->workers[slot] = job;
+                 break;
+             }
+         }
+         run->running++;
+     }
+     if (run->running == 0 && run->next >= run->args->len) {
+         parallel_finish(run);
+     }
+ }
+ 
+ /**
+  * @brief Biten "parallel" girdisinin süresini kaydeder ve yerine yenisini başlatır
+  * * @param job Biten iş (serbest bırakılır)
+  */
+ static void parallel_job_done(Job *job) {
+     ParallelRun *run = job->parallel;
+ 
+     if (job->line_buf) {
+         if (job->line_buf->len > 0) { // Son satırın sonunda '\n' yoksa
+             g_string_append_c(job->line_buf, '\n');
+             parallel_emit_line(job, job->line_buf->str);
+         }
+         g_string_free(job->line_buf, TRUE);
+     }
+ 
+     gint64 elapsed = (job->end_us ? job->end_us : g_get_monotonic_time()) - job->start_us;
+     if (run->finished == 0 || elapsed < run->job_min_us) run->job_min_us = elapsed;
+     if (elapsed > run->job_max_us) run->job_max_us = elapsed;
+     run->job_total_us += elapsed;
+     run->finished++;
+ 
+     int code = status_to_exit_code(job->last_status);
+     if (code != 0) run->failed++;
+     if (output_callback) {
+         char msg[64];
+         snprintf(msg, sizeof(msg), "%.3f s, çıkış %d\n", elapsed / 1e6, code);
+         const char *arg = g_ptr_array_index(run->args, job->parallel_item);
+         char prefix[PARALLEL_PREFIX_LEN + 8];
+         snprintf(prefix, sizeof(prefix), "[%.*s] ", PARALLEL_PREFIX_LEN, arg);
+         output_callback(job->tab_index, prefix, "gold");
+         output_callback(job->tab_index, msg, code ? "red" : "lightblue");
+     }
+ 
+     for (int slot = 0; slot < run->max_workers; slot++) {
+         if (run->workers[slot] == job) {
+             run->workers[slot] = NULL;
+             break;
+         }
+     }
+     run->running--;
+     g_free(job);
+     parallel_fill(run);
+ }
+ 
+ /**
+  * @brief Çalışan tüm girdilere sinyal gönderir ve kalan girdileri iptal eder
+  * * @param run Çalıştırma
+  * @param sig Gönderilecek sinyal
+  */
+ static void parallel_cancel(ParallelRun *run, int sig) {
+     run->next = run->args->len;
+     for (int slot = 0; slot < run->max_workers; slot++) {
+         Job *job = run->workers[slot];
+         if (job && job->pgid > 0) kill(-job->pgid, sig);
+     }
+ }
+ 
+ /**
+  * @brief Girdi dosyasındaki satırları girdi listesine ekler (boş satırlar atlanır)
+  * * @param dirfd Göreli yolun çözüleceği dizin (sekmenin dizini)
+  * @param path Dosya yolu
+  * @param args Girdilerin ekleneceği dizi
+  * @return int Başarılıysa 0, dosya açılamazsa -1
+  */
+ static int parallel_read_args(int dirfd, const char *path, GPtrArray *args) {
+     int fd = openat(dirfd, path, O_RDONLY | O_CLOEXEC);
+     if (fd == -1) return -1;
+     FILE *fp = fdopen(fd, "r");
+     if (!fp) {
+         close(fd);
+         return -1;
+     }
+     char *line = NULL;
+     size_t cap = 0;
+     ssize_t n;
+     while ((n = getline(&line, &cap, fp)) != -1) {
+         while (n > 0 && (line[n - 1] == '\n' || line[n - 1] == '\r')) line[--n] = '\0';
+         if (n > 0) g_ptr_array_add(args, g_strdup(line));
+     }
+     free(line);
+     fclose(fp);
+     return 0;
+ }
+ 
+ /**
+  * @brief Aynı komutu birçok girdi için paralel çalıştıran "parallel" komutu
+  * * Kullanım: parallel [-j N] komut {} ::: girdi1 girdi2 ...
+  *             parallel [-j N] komut {} < dosya
+  * N verilmezse çevrimiçi çekirdek sayısı kadar iş aynı anda çalışır. Her işin
+  * çıktı satırları girdinin önekiyle yazılır; her iş bitince süresi, en sonda da
+  * toplam süre ve iş süresi istatistikleri yazılır.
+  * * @param tab_index Komutun çalıştırıldığı sekme
+  * @param args Komut adından sonraki kısım
+  * @param background '&' ile başlatıldıysa 1 (sekme meşgul edilmez)
+  */
+ static void parallel_start(int tab_index, const char *args, int background) {
+     const char *usage = "Kullanım: parallel [-j N] komut {} ::: girdi ... | parallel [-j N] komut {} < dosya\n";
+     TokenList tokens;
+     const char *error = NULL;
+     char errbuf[320];
+     if (tokenize(args, tab_index, &tokens, &error) == -1) {
+         snprintf(errbuf, sizeof(errbuf), "parallel: %s\n", error);
+         command_error(tab_index, errbuf);
+         return;
+     }
+ 
+     long cores = sysconf(_SC_NPROCESSORS_ONLN);
+     int workers = cores > 0 ? (int)cores : 1;
+     GString *template = g_string_new(NULL);
+     GPtrArray *inputs = g_ptr_array_new_with_free_func(g_free);
+     int in_args = 0;
+ 
+     // Şablon belirteçleri yeniden tırnaklanarak birleştirilir; işleçler (|, > ...)
+     // olduğu gibi kalır ve her girdinin boru hattında işlenir
+     for (int i = 0; i < tokens.argc; i++) {
+         const char *tok = tokens.argv[i];
+         int op = tokens.flags[i] & TOKEN_OP;
+         if (in_args) {
+             g_ptr_array_add(inputs, g_strdup(tok));
+         } else if (!op && template->len == 0 && strncmp(tok, "-j", 2) == 0) {
+             const char *n = tok[2] ? tok + 2 : tokens.argv[++i];
+             char *end;
+             long value = n ? strtol(n, &end, 10) : 0;
+             if (!n || *end != '\0' || value < 1 || value > MAX_PARALLEL_WORKERS) {
+                 snprintf(errbuf, sizeof(errbuf), "parallel: -j 1 ile %d arasında olmalı\n", MAX_PARALLEL_WORKERS);
+                 error = errbuf;
+                 break;
+             }
+             workers = (int)value;
+         } else if (!op && strcmp(tok, ":::") == 0) {
+             in_args = 1;
+         } else if (op && strcmp(tok, "<") == 0) {
+             const char *path = tokens.argv[i + 1];
+             if (!path || (tokens.flags[i + 1] & TOKEN_OP)) {
+                 error = usage;
+             } else if (parallel_read_args(tab_dir_at(tab_index), path, inputs) == -1) {
+                 snprintf(errbuf, sizeof(errbuf), "parallel: %s: %s\n", path, strerror(errno));
+                 error = errbuf;
+             }
+             break;
+         } else {
+             if (template->len) g_string_append_c(template, ' ');
+             if (op) g_string_append(template, tok);
+             else parallel_append_word(template, tok);
+         }
+     }
+     token_list_free(&tokens);
+ 
+     if (!error && template->len == 0) error = usage;
+     if (!error && inputs->len == 0) error = "parallel: çalıştırılacak girdi yok\n";
+     if (error) {
+         command_error(tab_index, error);
+         g_string_free(template, TRUE);
+         g_ptr_array_free(inputs, TRUE);
+         return;
+     }
+ 
+     ParallelRun *run = g_new0(ParallelRun, 1);
+     run->tab_index = tab_index;
+     run->template = g_string_free(template, FALSE);
+     run->args = inputs;
+     run->max_workers = workers < (int)inputs->len ? workers : (int)inputs->len;
+     run->workers = g_new0(Job *, run->max_workers);
+     run->background = background;
+     run->start_us = g_get_monotonic_time();
+     if (!background && tab_index >= 0 && tab_index < MAX_TABS) {
+         tab_fg_parallel[tab_index] = run;
+     }
+     parallel_runs = g_list_prepend(parallel_runs, run);
+     parallel_fill(run);
+ }
+ 
+ // ------------------- Komut yerine koyma -------------------
+ 
+ #define SUBST_MAX_BYTES (1 << 20) // $(...) çıktısı için üst sınır
+ 
+ static void execute_command(int tab_index, char *line);
+ 
+ /**
+  * @brief Çıktısı beklenen bir $(...) veya `...`
+  * * İç komut sıradan bir iş olarak (run_pipeline) ön planda çalışır; stdout'u
+  * sekme yerine out tamponunda büyür. İş toplandığında sonuç line içindeki
+  * aralığın yerine tırnaklanarak konur ve satır yeniden çalıştırılır; satırda
+  * başka yerine koyma varsa aynı yol tekrarlanır.
+  */
+ typedef struct Substitution {
+     char *line;               // Yerine koyma bekleyen komut satırının tamamı
+     size_t start;             // "$(" veya '`' konumu
+     size_t end;               // Kapanıştan sonraki konum
+     int quoted;               // Çift tırnak içinde: sonuç tek sözcük olarak kalır
+     int assign;               // "AD=$(...)": sonuç sözcüklere bölünmez
+     GString *out;             // Toplanan stdout
+     int overflow;             // SUBST_MAX_BYTES aşıldı
+ } Substitution;
+ 
+ /**
+  * @brief Substitution'ı serbest bırakır
+  */
+ static void subst_free(Substitution *subst) {
+     g_free(subst->line);
+     g_string_free(subst->out, TRUE);
+     g_free(subst);
+ }
+ 
+ /**
+  * @brief Satırdaki ilk (tırnak dışı veya çift tırnak içi) komut yerine koymayı bulur
+  * * @param line Komut satırı
+  * @param start "$(" veya '`' konumu yazılır
+  * @param end Kapanıştan sonraki konum yazılır
+  * @param quoted Çift tırnak içindeyse 1 yazılır
+  * @return int Bulunduysa 1, yoksa 0, kapanmamışsa -1
+  */
+ static int subst_find(const char *line, size_t *start, size_t *end, int *quoted) {
+     int in_dq = 0;
+     for (const char *p = line; *p; p++) {
+         if (*p == '\\' && p[1]) {
+             p++;
+         } else if (*p == '\'' && !in_dq) {
+             p = strchr(p + 1, '\'');
+             if (!p) return 0; // Kapanmamış tırnağı tokenize bildirir
+         } else if (*p == '"') {
+             in_dq = !in_dq;
+         } else if ((*p == '$' && p[1] == '(') || *p == '`') {
+             const char *close = subst_close(p);
+             if (!close) return -1;
+             *start = p - line;
+             *end = close + 1 - line;
+             *quoted = in_dq;
+             return 1;
+         }
+     }
+     return 0;
+ }
+ 
+ /**
+  * @brief Satırda komut yerine koyma varsa en içtekini başlatır
+  * * "$(a $(b))" önce b'yi çalıştırır; sonucu yerine konunca satır yeniden
+  * işlenir. İç komut tek bir boru hattı olmalıdır (";", "&&", "||" yok).
+  * * @param tab_index Sekme
+  * @param line Komut satırı
+  * @return int Satır burada işlendiyse (iş başladı veya hata bildirildi) 1
+  */
+ static int subst_start(int tab_index, const char *line) {
+     size_t start, end;
+     int quoted;
+     int found = subst_find(line, &start, &end, &quoted);
+     if (found == 0) return 0;
+     if (found < 0) {
+         command_error(tab_index, "Sözdizimi hatası: kapanmamış $( veya `\n");
+         if (tab_index >= 0 && tab_index < MAX_TABS) tab_last_status[tab_index] = 2;
+         return 1;
+     }
+ 
+     // En içteki yerine koymaya in; iç komutun tırnakları kendi bağlamındadır
+     for (;;) {
+         size_t open_len = line[start] == '`' ? 1 : 2;
+         char *inner = g_strndup(line + start + open_len, end - start - open_len - 1);
+         size_t s2, e2;
+         int q2;
+         int nested = subst_find(inner, &s2, &e2, &q2);
+         g_free(inner);
+         if (nested != 1) break;
+         end = start + open_len + e2;
+         start = start + open_len + s2;
+         quoted = q2;
+     }
+ 
+     if (line[start] == '`') {
+         // `...` içinde "\`", "\$" ve "\\" kaçıştır: $(...) biçimine çevrilip
+         // yeniden işlenir, böylece iç içe ters tırnaklar da çalışır
+         GString *rewritten = g_string_new_len(line, start);
+         g_string_append(rewritten, "$(");
+         for (size_t i = start + 1; i < end - 1; i++) {
+             if (line[i] == '\\' && strchr("`$\\", line[i + 1])) i++;
+             g_string_append_c(rewritten, line[i]);
+         }
+         g_string_append_c(rewritten, ')');
+         g_string_append(rewritten, line + end);
+         int handled = subst_start(tab_index, rewritten->str);
+         g_string_free(rewritten, TRUE);
+         return handled;
+     }
+ 
+     Substitution *subst = g_new0(Substitution, 1);
+     subst->line = g_strdup(line);
+     subst->start = start;
+     subst->end = end;
+     subst->quoted = quoted;
+     subst->out = g_string_new(NULL);
+     if (!quoted) {
+         // Sözcüğün başı "AD=" ise atamadır
+         size_t w = start;
+         while (w > 0 && !isspace((unsigned char)line[w - 1])) w--;
+         size_t eq = w + strcspn(line + w, "=");
+         subst->assign = eq < start && is_var_name(line + w, eq - w);
+     }
+ 
+     char *inner = g_strndup(line + start + 2, end - start - 3);
+     const char *seg_end, *next;
+     Job *job = NULL;
+     if (*g_strstrip(inner) == '\0') {
+         subst_finish(tab_index, subst, 0); // "$()" boş sonuç verir
+     } else if (list_next(inner, &seg_end, &next) != LIST_END) {
+         command_error(tab_index, "Komut yerine koyma: içerde ';', '&&', '||' veya '&' desteklenmiyor\n");
+         subst_free(subst);
+     } else if (!(job = run_pipeline(tab_index, inner, NULL, NULL, subst))) {
+         if (tab_index >= 0 && tab_index < MAX_TABS) tab_last_status[tab_index] = 2;
+         subst_free(subst);
+     } else if (tab_index >= 0 && tab_index < MAX_TABS) {
+         tab_fg_job[tab_index] = job; // Dış komut sonucu bekler; Ctrl+C ikisini de keser
+     }
+     g_free(inner);
+     return 1;
+ }
+ 
+ /**
+  * @brief İç komutun çıktısını tampona ekler (on_job_output'tan)
+  */
+ static void subst_append(Substitution *subst, const char *data, size_t len) {
+     if (subst->overflow) return;
+     if (subst->out->len + len > SUBST_MAX_BYTES) {
+         subst->overflow = 1; // Kalan çıktı okunup atılır, iş kendi bitsin
+         return;
+     }
+     g_string_append_len(subst->out, data, len);
+ }
+ 
+ /**
+  * @brief İç komut bitince sonucu satıra yerleştirip satırı yeniden çalıştırır
+  * * Sondaki satır sonları atılır. Çift tırnak içindeki sonuç kaçışlanarak,
+  * tırnak dışındaki sonuç boşluklarda bölünüp her sözcük tırnaklanarak konur;
+  * böylece sonuçtaki ';', '|', '*' gibi karakterler yeniden yorumlanmaz.
+  * * @param tab_index Sekme
+  * @param subst Biten yerine koyma (serbest bırakılır)
+  * @param status İç komutun waitpid durumu
+  */
+ static void subst_finish(int tab_index, Substitution *subst, int status) {
+     if (status != -1 && WIFSIGNALED(status) && WTERMSIG(status) == SIGINT) {
+         subst_free(subst); // Ctrl+C: dış komut da çalışmaz
+         return;
+     }
+     if (subst->overflow) {
+         char msg[128];
+         snprintf(msg, sizeof(msg), "Komut yerine koyma: çıktı %d baytı aştı\n", SUBST_MAX_BYTES);
+         command_error(tab_index, msg);
+         subst_free(subst);
+         return;
+     }
+ 
+     GString *out = subst->out;
+     while (out->len > 0 && out->str[out->len - 1] == '\n') g_string_truncate(out, out->len - 1);
+     out->len = strlen(out->str); // NUL baytından sonrası atılır
+ 
+     GString *line = g_string_new_len(subst->line, subst->start);
+     if (subst->quoted) {
+         for (const char *p = out->str; *p; p++) {
+             if (strchr("\\\"$`", *p)) g_string_append_c(line, '\\');
+             g_string_append_c(line, *p);
+         }
+     } else if (subst->assign) {
+         if (out->len) append_quoted(line, out->str);
+     } else {
+         char **words = g_strsplit_set(out->str, " \t\n", -1);
+         int first = 1;
+         for (char **w = words; *w; w++) {
+             if (**w == '\0') continue;
+             if (!first) g_string_append_c(line, ' ');
+             append_quoted(line, *w);
+             first = 0;
+         }
+         g_strfreev(words);
+     }
+     g_string_append(line, subst->line + subst->end);
+     subst_free(subst);
+ 
+     execute_command(tab_index, line->str);
+     g_string_free(line, TRUE);
+ }
+ 
+ // ------------------- capture -------------------
+ 
+ #define SEARCH_CHUNK (1 << 20)    // Aramada tek turda okunacak bayt
+ #define SEARCH_MAX_MATCHES 100    // Gösterilecek en fazla eşleşme
+ #define SEARCH_LINE_MAX 200       // Eşleşen satırdan gösterilecek en fazla bayt
+ #define SEARCH_CARRY_MAX 65536    // Parçalar arasında taşınan satırın en fazla uzunluğu
+ 
+ /**
+  * @brief Ana döngüde parça parça ilerleyen bir yakalama araması
+  */
+ typedef struct {
+     int tab_index;            // Sonuçların yazılacağı sekme
+     int fd;                   // Yakalama dosyasının kopyası (yakalama silinse de arama sürer)
+     int capture_id;
+     off_t offset;             // Sıradaki okunacak konum
+     guint64 line_no;          // line_buf'taki satırın numarası
+     GString *line_buf;        // Parçalar arasında bölünen satır
+     char *pattern;
+     int matches;
+ } CaptureSearch;
+ 
+ /**
+  * @brief Tamamlanmış bir satırda aranan metni arar ve eşleşmeyi yazar
+  */
+ static void capture_search_line(CaptureSearch *search, const char *line, size_t len) {
+     search->line_no++;
+     if (search->matches >= SEARCH_MAX_MATCHES) return;
+     if (!memmem(line, len, search->pattern, strlen(search->pattern))) return;
+     search->matches++;
+     if (output_callback) {
+         char msg[SEARCH_LINE_MAX + 64];
+         snprintf(msg, sizeof(msg), "%llu: %.*s\n", (unsigned long long)search->line_no,
+                  (int)(len < SEARCH_LINE_MAX ? len : SEARCH_LINE_MAX), line);
+         output_callback(search->tab_index, msg, NULL);
+     }
+ }
+ 
+ /**
+  * @brief Parça sınırında bölünen satırı biriktirir
+  * * Çok uzun satırların yalnızca ilk SEARCH_CARRY_MAX baytı tutulur; böylece
+  * satır sonu içermeyen dev çıktılarda da bellek kullanımı sınırlı kalır.
+  */
+ static void capture_search_carry(CaptureSearch *search, const char *data, size_t len) {
+     size_t room = SEARCH_CARRY_MAX - search->line_buf->len;
+     g_string_append_len(search->line_buf, data, len < room ? len : room);
+ }
+ 
+ /**
+  * @brief Aramayı bir parça ilerletir (boşta kalan ana döngüde çağrılır)
+  * * Her turda en fazla SEARCH_CHUNK bayt okunur; böylece çok büyük dosyalarda
+  * da arayüz donmaz.
+  * * @return gboolean Arama sürdükçe G_SOURCE_CONTINUE
+  */
+ static gboolean capture_search_step(gpointer user_data) {
+     CaptureSearch *search = user_data;
+     char *chunk = g_malloc(SEARCH_CHUNK);
+     ssize_t n;
+     do {
+         n = pread(search->fd, chunk, SEARCH_CHUNK, search->offset);
+     } while (n == -1 && errno == EINTR);
+ 
+     if (n > 0) {
+         search->offset += n;
+         const char *p = chunk;
+         const char *end = chunk + n;
+         const char *nl;
+         while ((nl = memchr(p, '\n', end - p)) != NULL) {
+             if (search->line_buf->len) { // Önceki parçadan kalan satır başı
+                 capture_search_carry(search, p, nl - p);
+                 capture_search_line(search, search->line_buf->str, search->line_buf->len);
+                 g_string_truncate(search->line_buf, 0);
+             } else {
+                 capture_search_line(search, p, nl - p);
+             }
+             p = nl + 1;
+         }
+         capture_search_carry(search, p, end - p);
+         g_free(chunk);
+         if (search->matches < SEARCH_MAX_MATCHES) return G_SOURCE_CONTINUE;
+     } else {
+         g_free(chunk);
+         if (search->line_buf->len) {
+             capture_search_line(search, search->line_buf->str, search->line_buf->len);
+         }
+     }
+ 
+     if (output_callback) {
+         char msg[128];
+         snprintf(msg, sizeof(msg), "[capture %d: %d eşleşme%s]\n", search->capture_id, search->matches,
+                  search->matches >= SEARCH_MAX_MATCHES ? " (ilk eşleşmelerde durduruldu)" : "");
+         output_callback(search->tab_index, msg, "lightgreen");
+     }
+     close(search->fd);
+     g_string_free(search->line_buf, TRUE);
+     g_free(search->pattern);
+     g_free(search);
+     return G_SOURCE_REMOVE;
+ }
+ 
+ /**
+  * @brief Yakalamayı verilen yola kaydeder
+  * * Önce adsız dosyaya linkat ile ad verilir (kopyalama yok, anında). Bu mümkün
+  * değilse (başka dosya sistemi vb.) copy_file_range ile çekirdek içinde kopyalanır.
+  * * @param cap Kaydedilecek yakalama
+  * @param dirfd Göreli yolun çözüleceği dizin (sekmenin dizini)
+  * @param path Hedef yol (var olmamalı)
+  * @return int Başarılıysa 0, hata durumunda -1 (errno ayarlı)
+  */
+ static int capture_save(Capture *cap, int dirfd, const char *path) {
+     char proc_path[64];
+     snprintf(proc_path, sizeof(proc_path), "/proc/self/fd/%d", cap->fd);
+     if (linkat(AT_FDCWD, proc_path, dirfd, path, AT_SYMLINK_FOLLOW) == 0) return 0;
+     if (errno == EEXIST) return -1;
+ 
+     int out = openat(dirfd, path, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+     if (out == -1) return -1;
+     loff_t in_off = 0;
+     while ((size_t)in_off < cap->size) {
+         ssize_t n = copy_file_range(cap->fd, &in_off, out, NULL, cap->size - in_off, 0);
+         if (n == -1 && errno == EINTR) continue;
+         if (n <= 0) {
+             // copy_file_range desteklenmiyorsa okuma/yazma ile kopyala
+             char buffer[65536];
+             ssize_t r = pread(cap->fd, buffer, sizeof(buffer), in_off);
+             if (r <= 0 || write_all(out, buffer, r) == -1) {
+                 int saved = r == 0 ? EIO : errno;
+                 close(out);
+                 unlink(path);
+                 errno = saved;
+                 return -1;
+             }
+             in_off += r;
+         }
+     }
+     close(out);
+     return 0;
+ }
+ 
+ /**
+  * @brief "capture open" için yakalamaya TMPDIR altında adlı bir kopya verir
+  * * Ad rastgele bir sonek taşır ve capture_save hedefi O_EXCL ile (veya linkat
+  * ile) oluşturduğu için başka bir dosyanın üzerine yazılmaz; çakışmada yeni ad
+  * denenir. Kopya yakalamayla birlikte (capture rm, model_cleanup) silinir.
+  * Kullanıcı dosyayı silmişse yeniden oluşturulur.
+  * * @param cap Açılacak yakalama
+  * @return int Başarılıysa 0 (cap->export_path ayarlı), hata durumunda -1 (errno ayarlı)
+  */
+ static int capture_export(Capture *cap) {
+     if (cap->export_path) {
+         if (access(cap->export_path, F_OK) == 0) return 0;
+         g_free(cap->export_path);
+         cap->export_path = NULL;
+     }
+     for (int attempt = 0; attempt < 8; attempt++) {
+         char *path = g_strdup_printf("%s/simple-shell-capture-%d-%08x.txt",
+                                      g_get_tmp_dir(), cap->id, g_random_int());
+         if (capture_save(cap, AT_FDCWD, path) == 0) {
+             cap->export_path = path;
+             return 0;
+         }
+         int saved = errno;
+         g_free(path);
+         if (saved != EEXIST) {
+             errno = saved;
+             return -1;
+         }
+     }
+     errno = EEXIST;
+     return -1;
+ }
+ 
+ /**
+  * @brief "capture open" ile başlatılan görüntüleyici sonlandığında çağrılır
+  * * Görüntüleyici bir iş değildir; launcher onu toplar, burada yapılacak bir şey yoktur.
+  */
+ static void on_viewer_exited(pid_t pid, int status, const LaunchUsage *usage, void *user_data) {
+     (void)pid; (void)status; (void)usage; (void)user_data;
+ }
+ 
+ /**
+  * @brief Sekmede gösterilemeyen büyük çıktıları yöneten "capture" komutu
+  * * capture                     yakalamaları listeler
+  * capture open N              dosyayı varsayılan uygulamayla açar
+  * capture save N dosya        dosyaya kaydeder
+  * capture search N metin      metni içeren satırları listeler
+  * capture rm N                yakalamayı siler
+  * * @param tab_index Komutun çalıştırıldığı sekme
+  * @param args Komut adından sonraki kısım
+  */
+ static void capture_command(int tab_index, const char *args) {
+     const char *usage = "Kullanım: capture [open N | save N dosya | search N metin | rm N]\n";
+     char msg[PATH_MAX + 128];
+     char sub[16] = "";
+     int id = 0;
+     int consumed = 0;
+ 
+     if (sscanf(args, " %15s %d %n", sub, &id, &consumed) < 1) {
+         GString *out = g_string_new(NULL);
+         for (int i = 0; i < MAX_CAPTURES; i++) {
+             if (!captures[i]) continue;
+             char size[32];
+             format_size(captures[i]->size, size, sizeof(size));
+             g_string_append_printf(out, "%d\t%s\t%s\n", captures[i]->id, size, captures[i]->command);
+         }
+         if (output_callback) {
+             output_callback(tab_index, out->len ? out->str : "Yakalanmış çıktı yok\n", "lightgreen");
+         }
+         g_string_free(out, TRUE);
+         return;
+     }
+ 
+     if (!consumed) { // Alt komut var ama numara yok
+         command_error(tab_index, usage);
+         return;
+     }
+     Capture *cap = find_capture(id);
+     const char *rest = args + consumed;
+     if (!cap) {
+         snprintf(msg, sizeof(msg), "capture: %d numaralı yakalama yok\n", id);
+         command_error(tab_index, msg);
+         return;
+     }
+ 
+     if (strcmp(sub, "save") == 0 && *rest) {
+         if (capture_save(cap, tab_dir_at(tab_index), rest) == 0) {
+             snprintf(msg, sizeof(msg), "[capture %d: %s dosyasına kaydedildi]\n", cap->id, rest);
+             if (output_callback) output_callback(tab_index, msg, "lightgreen");
+         } else {
+             snprintf(msg, sizeof(msg), "capture: %s: %s\n", rest, strerror(errno));
+             command_error(tab_index, msg);
+         }
+     } else if (strcmp(sub, "open") == 0) {
+         if (capture_export(cap) == -1) {
+             snprintf(msg, sizeof(msg), "capture: %s\n", strerror(errno));
+             command_error(tab_index, msg);
+             return;
+         }
+         char *argv[] = { "xdg-open", cap->export_path, NULL };
+         LaunchSpec spec = {
+             .argv = argv,
+             .path = path_resolve(argv[0], getenv("PATH"), AT_FDCWD),
+             .stdin_fd = -1,
+             .stdout_fd = -1,
+             .stderr_fd = -1,
+             .pgid = 0,
+             .cwd_fd = -1,
+         };
+         LaunchError spawn_error = { .code = ENOENT, .redirect = -1 };
+         if (!spec.path || launcher_spawn(&spec, on_viewer_exited, NULL, &spawn_error) == -1) {
+             report_spawn_error(tab_index, &spec, &spawn_error);
+             if (tab_index >= 0 && tab_index < MAX_TABS) tab_last_status[tab_index] = 2;
+         }
+     } else if (strcmp(sub, "search") == 0 && *rest) {
+         int fd = fcntl(cap->fd, F_DUPFD_CLOEXEC, 0);
+         if (fd == -1) {
+             snprintf(msg, sizeof(msg), "capture: %s\n", strerror(errno));
+             command_error(tab_index, msg);
+             return;
+         }
+         CaptureSearch *search = g_new0(CaptureSearch, 1);
+         search->tab_index = tab_index;
+         search->fd = fd;
+         search->capture_id = cap->id;
+         search->line_buf = g_string_new(NULL);
+         search->pattern = g_strdup(rest);
+         g_idle_add(capture_search_step, search);
+     } else if (strcmp(sub, "rm") == 0) {
+         capture_free(cap);
+     } else if (output_callback) {
+         output_callback(tab_index, usage, "red");
+     }
+ }
+ 
+ /**
+  * @brief Sekmedeki işleri listeleyen "jobs" komutu
+  * * @param tab_index Komutun çalıştırıldığı sekme
+  */
+ static void show_jobs(int tab_index) {
+     Job *current = find_job(tab_index, NULL);
+     GString *out = g_string_new(NULL);
+     for (int id = 1; current && id <= current->id; id++) {
+         char spec[16];
+         snprintf(spec, sizeof(spec), "%%%d", id);
+         Job *job = find_job(tab_index, spec);
+         if (!job) continue;
+         g_string_append_printf(out, "[%d]%c %-7d %-11s %s%s\n", job->id,
+                                job == current ? '+' : ' ', job->pgid,
+                                job->stopped ? "Durduruldu" : "Çalışıyor",
+                                job->command, job->background && !job->stopped ? " &" : "");
+     }
+     if (output_callback && out->len) output_callback(tab_index, out->str, "lightgreen");
+     g_string_free(out, TRUE);
+ }
+ 
+ /**
+  * @brief Durdurulmuş veya arka plandaki işi ön plana alan "fg" komutu
+  * * Sekme iş bitene (veya yeniden durdurulana) kadar meşgul olur.
+  * * @param tab_index Komutun çalıştırıldığı sekme
+  * @param args İş belirteci (boşsa geçerli iş)
+  */
+ static void job_foreground(int tab_index, const char *args) {
+     Job *job = find_job(tab_index, args);
+     if (!job) {
+         command_error(tab_index, "fg: böyle bir iş yok\n");
+         return;
+     }
+     if (output_callback) {
+         output_callback(tab_index, job->command, "lightblue");
+         output_callback(tab_index, "\n", "lightblue");
+     }
+     job->background = 0;
+     tab_fg_job[tab_index] = job;
+     if (job->stopped) {
+         job->stopped = 0;
+         job_set_process_status(job, 0);
+         if (job->pgid > 0) kill(-job->pgid, SIGCONT);
+     }
+ }
+ 
+ /**
+  * @brief Durdurulmuş işi arka planda sürdüren "bg" komutu
+  * * @param tab_index Komutun çalıştırıldığı sekme
+  * @param args İş belirteci (boşsa geçerli iş)
+  */
+ static void job_background(int tab_index, const char *args) {
+     Job *job = find_job(tab_index, args);
+     char msg[320];
+     if (!job) {
+         snprintf(msg, sizeof(msg), "bg: böyle bir iş yok\n");
+     } else if (!job->stopped) {
+         snprintf(msg, sizeof(msg), "bg: %%%d işi zaten arka planda çalışıyor\n", job->id);
+     } else {
+         job->stopped = 0;
+         job->background = 1;
+         job_set_process_status(job, 0);
+         if (job->pgid > 0) kill(-job->pgid, SIGCONT);
+         snprintf(msg, sizeof(msg), "[%d]+ %s &\n", job->id, job->command);
+         if (output_callback) output_callback(tab_index, msg, "lightblue");
+         return;
+     }
+     command_error(tab_index, msg);
+ }
+ 
+ /**
+  * @brief Sinyal adını veya numarasını çözer ("9", "KILL", "SIGKILL")
+  * * @param name Sinyal belirteci ('-' olmadan)
+  * @return int Sinyal numarası veya tanınmıyorsa -1
+  */
+ static int parse_signal(const char *name) {
+     static const struct { const char *name; int sig; } signals[] = {
+         { "HUP", SIGHUP }, { "INT", SIGINT }, { "QUIT", SIGQUIT }, { "KILL", SIGKILL },
+         { "USR1", SIGUSR1 }, { "USR2", SIGUSR2 }, { "TERM", SIGTERM }, { "CONT", SIGCONT },
+         { "STOP", SIGSTOP }, { "TSTP", SIGTSTP }, { "TTIN", SIGTTIN }, { "TTOU", SIGTTOU },
+     };
+     if (isdigit((unsigned char)name[0])) {
+         char *end;
+         long sig = strtol(name, &end, 10);
+         return (*end == '\0' && sig >= 0 && sig < NSIG) ? (int)sig : -1;
+     }
+     if (strncmp(name, "SIG", 3) == 0) name += 3;
+     for (size_t i = 0; i < sizeof(signals) / sizeof(signals[0]); i++) {
+         if (strcmp(name, signals[i].name) == 0) return signals[i].sig;
+     }
+     return -1;
+ }
+ 
+ /**
+  * @brief Bir işin süreç grubuna veya bir PID'ye sinyal gönderen "kill" komutu
+  * * Kullanım: kill [-SİNYAL] %n|pid ... (varsayılan SIGTERM). Durdurulmuş bir işe
+  * sonlandırma sinyali gönderildiğinde, sinyali işleyebilmesi için SIGCONT da
+  * gönderilir.
+  * * @param tab_index Komutun çalıştırıldığı sekme
+  * @param args Komut adından sonraki kısım
+  */
+ static void job_kill(int tab_index, const char *args) {
+     TokenList tokens;
+     const char *error;
+     char msg[320];
+     if (tokenize(args, tab_index, &tokens, &error) == -1) {
+         snprintf(msg, sizeof(msg), "kill: %s\n", error);
+         command_error(tab_index, msg);
+         return;
+     }
+     char **argv = tokens.argv;
+     int argc = tokens.argc;
+     int sig = SIGTERM;
+     int i = 0;
+ 
+     if (argc > 0 && argv[0][0] == '-') {
+         sig = parse_signal(argv[0] + 1);
+         if (sig == -1) {
+             snprintf(msg, sizeof(msg), "kill: %s: geçersiz sinyal\n", argv[0] + 1);
+             command_error(tab_index, msg);
+             token_list_free(&tokens);
+             return;
+         }
+         i = 1;
+     }
+     if (i == argc && output_callback) {
+         output_callback(tab_index, "Kullanım: kill [-SİNYAL] %n|pid ...\n", "red");
+     }
+ 
+     for (; i < argc; i++) {
+         Job *job = NULL;
+         pid_t target;
+         if (argv[i][0] == '%') {
+             job = find_job(tab_index, argv[i]);
+             if (!job || job->pgid <= 0) {
+                 snprintf(msg, sizeof(msg), "kill: %s: böyle bir iş yok\n", argv[i]);
+                 command_error(tab_index, msg);
+                 continue;
+             }
+             target = -job->pgid;
+         } else {
+             char *end;
+             target = (pid_t)strtol(argv[i], &end, 10);
+             if (*end != '\0' || target <= 0) {
+                 snprintf(msg, sizeof(msg), "kill: %s: geçersiz PID veya iş belirteci\n", argv[i]);
+                 command_error(tab_index, msg);
+                 continue;
+             }
+         }
+ 
+         if (kill(target, sig) == -1) {
+             snprintf(msg, sizeof(msg), "kill: %s: %s\n", argv[i], strerror(errno));
+             command_error(tab_index, msg);
+             continue;
+         }
+         if (!job) continue;
+         if (sig == SIGSTOP || sig == SIGTSTP || sig == SIGTTIN || sig == SIGTTOU) {
+             job_mark_stopped(job);
+         } else if (job->stopped && sig != 0) {
+             if (sig != SIGCONT) kill(target, SIGCONT);
+             job->stopped = 0;
+             job_set_process_status(job, 0);
+         }
+     }
+     token_list_free(&tokens);
+ }
+ 
+ /**
+  * @brief Arka plan işlerinin bitmesini bekleyen "wait" komutu
+  * * Sekme, beklenen işler bitene kadar meşgul olur; bu sırada girilen komutlar
+  * sıraya alınır. Ctrl+C beklemeyi iptal eder.
+  * * @param tab_index Komutun çalıştırıldığı sekme
+  * @param args İş belirteci (boşsa tüm arka plan işleri)
+  */
+ static void job_wait(int tab_index, const char *args) {
+     if (*args) {
+         Job *job = find_job(tab_index, args);
+         if (!job) {
+             command_error(tab_index, "wait: böyle bir iş yok\n");
+             return;
+         }
+         tab_wait_id[tab_index] = job->id;
+     } else {
+         tab_wait_id[tab_index] = -1;
+     }
+     tab_check_wait(tab_index); // Beklenecek iş yoksa hemen döner
+ }
+ 
+ /**
+  * @brief Sekmenin ön plandaki işine sinyal gönderir (Ctrl+C / Ctrl+Z)
+  * * SIGTSTP/SIGSTOP işi durdurur ve sekmeyi serbest bırakır. Ön planda iş yokken
+  * SIGINT, devam eden bir "wait" beklemesini iptal eder. SIGINT ayrıca yarıda
+  * kalmış komut listesinin kalanını iptal eder.
+  * * @param tab_index Sekme
+  * @param sig Gönderilecek sinyal
+  * @return int Bir iş sinyallendiyse veya bekleme iptal edildiyse 1
+  */
+ int model_signal_foreground(int tab_index, int sig) {
+     if (tab_index < 0 || tab_index >= MAX_TABS) return 0;
+     if (sig == SIGINT && tab_sequence[tab_index]) {
+         // Kesilen komut listesinin kalanı çalıştırılmaz (bash'teki gibi)
+         g_free(tab_sequence[tab_index]);
+         tab_sequence[tab_index] = NULL;
+     }
+     if (tab_fg_parallel[tab_index]) {
+         // "parallel" durdurulamaz; kesme sinyali kalan girdileri de iptal eder
+         if (sig == SIGTSTP || sig == SIGSTOP) return 0;
+         parallel_cancel(tab_fg_parallel[tab_index], sig);
+         return 1;
+     }
+     Job *job = tab_fg_job[tab_index];
+     if (!job) {
+         if (sig != SIGINT || tab_wait_id[tab_index] == 0) return 0;
+         tab_wait_id[tab_index] = 0;
+         tab_run_pending(tab_index);
+         return 1;
+     }
+     // $(...) işi durdurulursa dış komut sıra dışı çalışırdı
+     if (job->subst && (sig == SIGTSTP || sig == SIGSTOP)) return 0;
+     if (job->pgid <= 0 || kill(-job->pgid, sig) == -1) return 0;
+     if (sig == SIGTSTP || sig == SIGSTOP) job_mark_stopped(job);
+     return 1;
+ }
+ 
+ /**
+  * @brief Sekme kapatıldığında sekmenin işlerini sonlandırır ve durumunu sıfırlar
+  * * Sekmenin tüm iş gruplarına (durdurulmuş olanlar SIGCONT ile sürdürülerek)
+  * ve "parallel" girdilerine SIGHUP gönderilir. İşler sekmeden ayrılır: kalan
+  * çıktıları atılır ve toplandıklarında sessizce serbest bırakılır. Sıradaki
+  * komutlar ve yarıda kalmış komut listesi silinir; dizin fd'leri, pushd
+  * yığını, değişkenler ve sekme ayarları bırakılır, böylece aynı indeksle
+  * açılan yeni sekme temiz başlar.
+  * * @param tab_index Kapatılan sekme
+  */
+ void model_tab_closed(int tab_index) {
+     if (tab_index < 0 || tab_index >= MAX_TABS) return;
+ 
+     g_free(tab_sequence[tab_index]);
+     tab_sequence[tab_index] = NULL;
+     while (!g_queue_is_empty(&tab_pending[tab_index])) free(g_queue_pop_head(&tab_pending[tab_index]));
+     tab_wait_id[tab_index] = 0;
+     tab_fg_job[tab_index] = NULL;
+     tab_fg_parallel[tab_index] = NULL;
+ 
+     if (tab_jobs[tab_index]) {
+         GHashTableIter it;
+         gpointer value;
+         g_hash_table_iter_init(&it, tab_jobs[tab_index]);
+         while (g_hash_table_iter_next(&it, NULL, &value)) {
+             Job *job = value;
+             if (job->pgid > 0) {
+                 kill(-job->pgid, SIGHUP);
+                 if (job->stopped) kill(-job->pgid, SIGCONT); // Durdurulmuş grup SIGHUP'ı ancak sürünce alır
+             }
+             job->tab_index = -1; // Tablodan çıkmış sayılır; job_unregister bir şey yapmaz
+         }
+         g_hash_table_remove_all(tab_jobs[tab_index]);
+         tab_next_job_id[tab_index] = 1;
+     }
+     for (GList *l = parallel_runs; l; l = l->next) {
+         ParallelRun *run = l->data;
+         if (run->tab_index != tab_index) continue;
+         parallel_cancel(run, SIGHUP);
+         run->tab_index = -1;
+         for (int slot = 0; slot < run->max_workers; slot++) {
+             if (run->workers[slot]) run->workers[slot]->tab_index = -1;
+         }
+     }
+ 
+     tab_dir_clear(&tab_cwd[tab_index]);
+     tab_dir_clear(&tab_oldpwd[tab_index]);
+     TabDir *dir;
+     while ((dir = g_queue_pop_head(&tab_dirstack[tab_index]))) {
+         tab_dir_clear(dir);
+         g_free(dir);
+     }
+ 
+     TabVars *tv = &tab_vars[tab_index];
+     if (tv->vars) g_hash_table_destroy(tv->vars);
+     g_free(tv->envp);
+     *tv = (TabVars){ NULL, NULL, 0 };
+ 
+     tab_last_status[tab_index] = 0;
+     tab_out_mode[tab_index] = OUT_MODE_PIPE;
+     tab_limits[tab_index] = (JobLimits){ 0 };
+ }
+ 
+ /**
+  * @brief Komut satırının sonundaki '&' işaretini ayıklar
+  * * "a && b" ve "2>&1" gibi yapılardaki ve kaçışlı ("\\&") '&' karakterlerine dokunulmaz.
+  * * @param line Değiştirilebilir komut satırı
+  * @return int Komut arka planda çalıştırılacaksa 1
+  */
+ static int strip_background(char *line) {
+     size_t len = strlen(line);
+     while (len > 0 && isspace((unsigned char)line[len - 1])) line[--len] = '\0';
+     if (len == 0 || line[len - 1] != '&' || (len > 1 && (line[len - 2] == '&' || line[len - 2] == '\\'))) return 0;
+     line[--len] = '\0';
+     while (len > 0 && isspace((unsigned char)line[len - 1])) line[--len] = '\0';
+     return 1;
+ }
+ 
+ // ------------------- Yerleşik komutlar -------------------
+ 
+ /**
+  * @brief Yerleşik komut tablosundaki bir kayıt
+  * * func satırın kalanını alır. run ise belirteçlere ayrılmış argümanlarla
+  * süreç başlatmadan çalışan hızlı yoldur; çıkış kodunu döndürür, -1 dönerse
+  * komut dış program olarak çalıştırılır.
+  */
+ typedef struct {
+     BuiltinFunc func;
+     int (*run)(int tab_index, int argc, char **argv);
+     int flags;                // BUILTIN_* bayrakları
+ } Builtin;
+ 
+ static GHashTable *builtins = NULL; // Komut adı -> Builtin
+ 
+ /**
+  * @brief Komut satırını iş olarak başlatır
+  * * Ön plandaki iş sekmeyi bitene kadar meşgul eder; arka plandaki işin
+  * numarası ve süreç grubu yazılır.
+  * * @param tab_index Komutun çalıştırılacağı sekme
+  * @param command Çalıştırılacak komut satırı
+  * @param timed Bitince "time" özeti yazılsın mı
+  * @param background '&' ile mi başlatıldı
+  * @param limits Komuta özel sınırlar (NULL = sekmenin sınırları)
+  */
+ static void start_job(int tab_index, const char *command, int timed, int background, const JobLimits *limits) {
+     Job *job = run_pipeline(tab_index, command, NULL, limits, NULL);
+     if (!job) {
+         // Sözdizimi veya kaynak hatası: hiçbir süreç başlamadı
+         if (tab_index >= 0 && tab_index < MAX_TABS) tab_last_status[tab_index] = 2;
+         return;
+     }
+     job->timed = timed;
+     if (background) {
+         job->background = 1;
+         if (output_callback) {
+             char msg[64];
+             snprintf(msg, sizeof(msg), "[%d] %d\n", job->id, job->pgid);
+             output_callback(tab_index, msg, "lightblue");
+         }
+     } else if (tab_index >= 0 && tab_index < MAX_TABS) {
+         tab_fg_job[tab_index] = job;
+     }
+ }
+ 
+ /**
+  * @brief Tampondaki yerleşik komut çıktısını sekmeye yazar ve tamponu bırakır
+  * * Çıktı, iş çıktısıyla aynı yoldan (job_append_output) geçer: uzunluğuna göre
+  * yazılır (NUL'dan sonrası kaybolmaz), pencereyi aşarsa sonu gösterilir ve
+  * tamamı "capture" ile erişilebilir olur.
+  * * @param tab_index Çıktının yazılacağı sekme
+  * @param command Komut adı ("capture" listesi için)
+  * @param out Çıktı
+  */
+ static void builtin_write(int tab_index, const char *command, GString *out) {
+     if (out->len) {
+         Job *job = g_new0(Job, 1);
+         job->tab_index = tab_index;
+         job->capture_fd = -1;
+         g_strlcpy(job->command, command, sizeof(job->command));
+         job_append_output(job, out->str, out->len);
+         job_show_tail(job);
+         job_finish_capture(job);
+         g_free(job);
+     }
+     g_string_free(out, TRUE);
+ }
+ 
+ /**
+  * @brief Ters bölü kaçışını çözüp çıktıya ekler (echo -e, printf)
+  * * @param out Hedef
+  * @param p Ters bölüden sonraki karakter
+  * @param octal0 Sekizli kaçış echo'daki gibi "\0nnn" ise 1, printf'teki gibi "\nnn" ise 0
+  * @param stop "\c" görülürse 1 yapılır; çıktının kalanı atılır
+  * @return const char* Kaçıştan sonraki konum
+  */
+ static const char* append_escape(GString *out, const char *p, int octal0, int *stop) {
+     static const char plain[] = "a\ab\be\033f\fn\nr\rt\tv\v\\\\";
+     for (const char *c = plain; *c; c += 2) {
+         if (*p == c[0]) {
+             g_string_append_c(out, c[1]);
+             return p + 1;
+         }
+     }
+     if (*p == 'c') {
+         *stop = 1;
+         return p + 1;
+     }
+     if (*p == 'x' && isxdigit((unsigned char)p[1])) {
+         char hex[3] = { p[1], isxdigit((unsigned char)p[2]) ? p[2] : '\0', '\0' };
+         g_string_append_c(out, (char)strtol(hex, NULL, 16));
+         return p + 1 + strlen(hex);
+     }
+     if (*p >= '0' && *p <= '7' && (!octal0 || *p == '0')) {
+         const char *q = p + octal0;
+         int value = 0, digits = 0;
+         for (; digits < 3 && q[digits] >= '0' && q[digits] <= '7'; digits++) value = value * 8 + (q[digits] - '0');
+         g_string_append_c(out, (char)value);
+         return q + digits;
+     }
+     g_string_append_c(out, '\\');
+     if (*p == '\0') return p;
+     g_string_append_c(out, *p);
+     return p + 1;
+ }
+ 
+ /**
+  * @brief "echo [-neE] metin ...": argümanları boşlukla birleştirip yazar
+  * * bash'teki gibi yalnızca tamamı n, e, E harflerinden oluşan seçenekler tanınır.
+  */
+ static int builtin_echo(int tab_index, int argc, char **argv) {
+     int newline = 1, escapes = 0, stop = 0, i = 1;
+     for (; i < argc && argv[i][0] == '-' && argv[i][1] && !argv[i][1 + strspn(argv[i] + 1, "neE")]; i++) {
+         for (const char *f = argv[i] + 1; *f; f++) {
+             if (*f == 'n') newline = 0;
+             else escapes = (*f == 'e');
+         }
+     }
+ 
+     GString *out = g_string_new(NULL);
+     for (int first = i; i < argc && !stop; i++) {
+         if (i > first) g_string_append_c(out, ' ');
+         if (!escapes) {
+             g_string_append(out, argv[i]);
+             continue;
+         }
+         for (const char *p = argv[i]; *p && !stop;) {
+             if (*p == '\\') p = append_escape(out, p + 1, 1, &stop);
+             else g_string_append_c(out, *p++);
+         }
+     }
+     if (newline && !stop) g_string_append_c(out, '\n');
+     builtin_write(tab_index, argv[0], out);
+     return 0;
+ }
+ 
+ /**
+  * @brief printf'in sayısal argümanını çözer ("42", "0x2a", "052", "'A")
+  * * @param tab_index Hata mesajının yazılacağı sekme
+  * @param arg Argüman (NULL veya boşsa 0)
+  * @param floating %e/%f/%g için 1 (ondalıklı sayı), tamsayı dönüşümleri için 0
+  * @param status Geçersiz sayıda 1 yapılır
+  * @return long double Değer
+  */
+ static long double printf_number(int tab_index, const char *arg, int floating, int *status) {
+     if (!arg || !*arg) return 0;
+     if (arg[0] == '\'' || arg[0] == '"') return (unsigned char)arg[1];
+     char *end;
+     errno = 0;
+     long double value = floating ? strtold(arg, &end) : (long double)strtoll(arg, &end, 0);
+     if (*end || errno) {
+         char msg[320];
+         snprintf(msg, sizeof(msg), "printf: %s: geçersiz sayı\n", arg);
+         if (output_callback) output_callback(tab_index, msg, "red");
+         *status = 1;
+     }
+     return value;
+ }
+ 
+ /**
+  * @brief "printf biçim [argüman ...]": biçimi argümanlarla doldurarak yazar
+  * * %d %i %o %u %x %X %c %s %b %e %f %g %a dönüşümlerini bayrak, genişlik ve
+  * duyarlıkla destekler. Argümanlar bitene kadar biçim yeniden uygulanır.
+  */
+ static int builtin_printf(int tab_index, int argc, char **argv) {
+     int i = (argc > 1 && strcmp(argv[1], "--") == 0) ? 2 : 1;
+     if (i >= argc) {
+         if (output_callback) output_callback(tab_index, "Kullanım: printf biçim [argüman ...]\n", "red");
+         return 2;
+     }
+     const char *format = argv[i++];
+     int status = 0, stop = 0, start;
+     GString *out = g_string_new(NULL);
+ 
+     do {
+         start = i;
+         for (const char *p = format; *p && !stop;) {
+             if (*p == '\\') {
+                 p = append_escape(out, p + 1, 0, &stop);
+                 continue;
+             }
+             if (*p != '%' || p[1] == '%') {
+                 g_string_append_c(out, *p);
+                 p += (*p == '%') ? 2 : 1;
+                 continue;
+             }
+ 
+             // "%[bayraklar][genişlik][.duyarlık]" olduğu gibi, '*' ise argümandan alınır
+             char spec[48] = "%";
+             size_t n = 1;
+             for (p++; *p && strchr("-+ #0", *p); p++) {
+                 if (n < 8) spec[n++] = *p;
+             }
+             for (int part = 0; part < 2; part++) {
+                 if (part == 1) {
+                     if (*p != '.') break;
+                     spec[n++] = *p++;
+                 }
+                 if (*p == '*') {
+                     n += snprintf(spec + n, 12, "%d", (int)printf_number(tab_index, i < argc ? argv[i] : NULL, 0, &status));
+                     if (i < argc) i++;
+                     p++;
+                 }
+                 for (; isdigit((unsigned char)*p); p++) {
+                     if (n < 8 + 12 * (part + 1)) spec[n++] = *p;
+                 }
+             }
+ 
+             char conv = *p;
+             if (!conv || !strchr("diouxXcsbeEfFgGaA", conv)) {
+                 char msg[64];
+                 snprintf(msg, sizeof(msg), "printf: %%%c: geçersiz dönüşüm\n", conv ? conv : ' ');
+                 if (output_callback) output_callback(tab_index, msg, "red");
+                 status = 1;
+                 stop = 1;
+                 break;
+             }
+             p++;
+             const char *arg = i < argc ? argv[i++] : NULL;
+ 
+             if (strchr("di", conv)) {
+                 strcpy(spec + n, "lld");
+                 g_string_append_printf(out, spec, (long long)printf_number(tab_index, arg, 0, &status));
+             } else if (strchr("ouxX", conv)) {
+                 snprintf(spec + n, 4, "ll%c", conv);
+                 g_string_append_printf(out, spec, (unsigned long long)(long long)printf_number(tab_index, arg, 0, &status));
+             } else if (strchr("eEfFgGaA", conv)) {
+                 snprintf(spec + n, 3, "L%c", conv);
+                 g_string_append_printf(out, spec, printf_number(tab_index, arg, 1, &status));
+             } else if (conv == 'b') {
+                 // %b: argümandaki kaçışlar çözülür, "\c" tüm çıktıyı bitirir
+                 GString *text = g_string_new(NULL);
+                 for (const char *q = arg ? arg : ""; *q && !stop;) {
+                     if (*q == '\\') q = append_escape(text, q + 1, 1, &stop);
+                     else g_string_append_c(text, *q++);
+                 }
+                 strcpy(spec + n, "s");
+                 g_string_append_printf(out, spec, text->str);
+                 g_string_free(text, TRUE);
+             } else {
+                 char first[2] = { arg ? arg[0] : '\0', '\0' };
+                 strcpy(spec + n, "s");
+                 g_string_append_printf(out, spec, conv == 'c' ? first : (arg ? arg : ""));
+             }
+         }
+     } while (!stop && i < argc && i > start);
+ 
+     builtin_write(tab_index, argv[0], out);
+     return status;
+ }
+ 
+ /**
+  * @brief "pwd": sekmenin çalışma dizinini yazar
+  */
+ static int builtin_pwd(int tab_index, int argc, char **argv) {
+     const char *cwd = model_get_cwd(tab_index);
+     if (!cwd) {
+         if (output_callback) output_callback(tab_index, "pwd: çalışma dizini alınamadı\n", "red");
+         return 1;
+     }
+     GString *out = g_string_new(cwd);
+     g_string_append_c(out, '\n');
+     builtin_write(tab_index, argv[0], out);
+     return 0;
+ }
+ 
+ /**
+  * @brief "env": sekmenin çocuklara verdiği ortamı yazar
+  * * "env DEĞİŞKEN=değer komut" gibi argümanlı kullanımlar dış env'e bırakılır.
+  */
+ static int builtin_env(int tab_index, int argc, char **argv) {
+     if (argc > 1) return -1;
+     guint64 env_id;
+     char *const *envp = tab_env(tab_index, &env_id);
+     GString *out = g_string_new(NULL);
+     for (char *const *var = envp ? envp : environ; *var; var++) {
+         g_string_append(out, *var);
+         g_string_append_c(out, '\n');
+     }
+     builtin_write(tab_index, argv[0], out);
+     return 0;
+ }
+ 
+ static int builtin_true(int tab_index, int argc, char **argv) { return 0; }
+ static int builtin_false(int tab_index, int argc, char **argv) { return 1; }
+ 
+ static void builtin_ps(int tab_index, const char *args, int background) {
+     if (output_callback) output_callback(tab_index, get_process_list(), "lightgreen");
+ }
+ static void builtin_spawnstat(int tab_index, const char *args, int background) { show_spawn_stats(tab_index); }
+ static void builtin_outmode(int tab_index, const char *args, int background) { show_out_mode(tab_index, args); }
+ static void builtin_hash(int tab_index, const char *args, int background) { show_path_cache(tab_index, args); }
+ static void builtin_jobs(int tab_index, const char *args, int background) { show_jobs(tab_index); }
+ static void builtin_fg(int tab_index, const char *args, int background) { job_foreground(tab_index, args); }
+ static void builtin_bg(int tab_index, const char *args, int background) { job_background(tab_index, args); }
+ static void builtin_kill(int tab_index, const char *args, int background) { job_kill(tab_index, args); }
+ static void builtin_wait(int tab_index, const char *args, int background) { job_wait(tab_index, args); }
+ static void builtin_cd(int tab_index, const char *args, int background) { change_dir(tab_index, args); }
+ static void builtin_pushd(int tab_index, const char *args, int background) { push_dir(tab_index, args); }
+ static void builtin_popd(int tab_index, const char *args, int background) { pop_dir(tab_index); }
+ static void builtin_dirs(int tab_index, const char *args, int background) { show_dirs(tab_index); }
+ static void builtin_capture(int tab_index, const char *args, int background) { capture_command(tab_index, args); }
+ static void builtin_parallel(int tab_index, const char *args, int background) { parallel_start(tab_index, args, background); }
+ static void builtin_export(int tab_index, const char *args, int background) { var_command(tab_index, 0, args); }
+ static void builtin_unset(int tab_index, const char *args, int background) { var_command(tab_index, 1, args); }
+ 
+ /**
+  * @brief "time komut": komutu çalıştırır, bitince süre ve kaynak özetini yazar
+  */
+ static void builtin_time(int tab_index, const char *args, int background) {
+     if (*args) start_job(tab_index, args, 1, background, NULL);
+     else if (output_callback) output_callback(tab_index, "Kullanım: time komut\n", "orange");
+ }
+ 
+ /**
+  * @brief "limit [-t süre] [-c cpu] [-m bellek] [-n dosya] [-r] [komut]"
+  * * Komut verilirse yalnızca o komut, sekmenin sınırları seçeneklerle
+  * değiştirilerek çalıştırılır; verilmezse seçenekler sekmenin sonraki tüm
+  * komutlarına uygulanır. Argümansız "limit" geçerli sınırları gösterir.
+  */
+ static void builtin_limit(int tab_index, const char *args, int background) {
+     if (tab_index < 0 || tab_index >= MAX_TABS) return;
+     JobLimits limits = tab_limits[tab_index];
+     const char *command = limit_parse(tab_index, args, &limits);
+     if (!command) return;
+     if (*command) {
+         start_job(tab_index, command, 0, background, &limits);
+     } else {
+         tab_limits[tab_index] = limits;
+         show_limits(tab_index);
+     }
+ }
+ 
+ /**
+  * @brief Model'in kendi yerleşik komutlarını tabloya ekler
+  * * ps, jobs, popd gibi argümansız komutlar BUILTIN_NO_ARGS ile kaydedilir ki
+  * "ps aux" gibi kullanımlar dış programa gitsin.
+  */
+ static void builtins_init(void) {
+     static const struct {
+         const char *name;
+         BuiltinFunc func;
+         int (*run)(int tab_index, int argc, char **argv);
+         int flags;
+     } table[] = {
+         { "ps",        builtin_ps,        NULL, BUILTIN_IMMEDIATE | BUILTIN_NO_ARGS },
+         { "spawnstat", builtin_spawnstat, NULL, BUILTIN_IMMEDIATE | BUILTIN_NO_ARGS },
+         { "jobs",      builtin_jobs,      NULL, BUILTIN_IMMEDIATE | BUILTIN_NO_ARGS },
+         { "bg",        builtin_bg,        NULL, BUILTIN_IMMEDIATE },
+         { "kill",      builtin_kill,      NULL, BUILTIN_IMMEDIATE },
+         { "outmode",   builtin_outmode,   NULL, 0 },
+         { "hash",      builtin_hash,      NULL, 0 },
+         { "fg",        builtin_fg,        NULL, 0 },
+         { "wait",      builtin_wait,      NULL, 0 },
+         { "cd",        builtin_cd,        NULL, 0 },
+         { "pushd",     builtin_pushd,     NULL, 0 },
+         { "popd",      builtin_popd,      NULL, BUILTIN_NO_ARGS },
+         { "dirs",      builtin_dirs,      NULL, BUILTIN_NO_ARGS },
+         { "capture",   builtin_capture,   NULL, 0 },
+         { "parallel",  builtin_parallel,  NULL, 0 },
+         { "time",      builtin_time,      NULL, 0 },
+         { "limit",     builtin_limit,     NULL, 0 },
+         { "export",    builtin_export,    NULL, 0 },
+         { "unset",     builtin_unset,     NULL, 0 },
+         // Süreç içi hızlı yollar: fork/exec yerine doğrudan çalışır
+         { "echo",      NULL, builtin_echo,   0 },
+         { "printf",    NULL, builtin_printf, 0 },
+         { "pwd",       NULL, builtin_pwd,    0 },
+         { "env",       NULL, builtin_env,    0 },
+         { "true",      NULL, builtin_true,   0 },
+         { "false",     NULL, builtin_false,  0 },
+     };
+     builtins = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, g_free);
+     for (size_t i = 0; i < sizeof(table) / sizeof(table[0]); i++) {
+         Builtin *builtin = g_new(Builtin, 1);
+         *builtin = (Builtin){ table[i].func, table[i].run, table[i].flags };
+         g_hash_table_replace(builtins, g_strdup(table[i].name), builtin);
+     }
+ }
+ 
+ /**
+  * @brief Yerleşik komut ekler veya aynı adlı komutun yerine geçer
+  * * Controller, View'a yazan komutlarını (clear, help ...) bununla kaydeder.
+  * * @param name Komut adı
+  * @param func Komutu çalıştıran fonksiyon
+  * @param flags BUILTIN_* bayrakları
+  */
+ void model_register_builtin(const char *name, BuiltinFunc func, int flags) {
+     if (!builtins) builtins_init();
+     Builtin *builtin = g_new(Builtin, 1);
+     *builtin = (Builtin){ func, NULL, flags };
+     g_hash_table_replace(builtins, g_strdup(name), builtin);
+ }
+ 
+ /**
+  * @brief Komut satırının ilk sözcüğünü yerleşik komut tablosunda arar
+  * * @param line Baştaki boşlukları atılmış komut satırı
+  * @param args NULL değilse komut adından sonraki kısım (boşluklar atılmış) yazılır
+  * @return const Builtin* Yerleşik komut veya NULL
+  */
+ static const Builtin* builtin_lookup(const char *line, const char **args) {
+     if (!builtins) builtins_init();
+     char name[32];
+     size_t len = strcspn(line, " \t");
+     if (len == 0 || len >= sizeof(name)) return NULL;
+     memcpy(name, line, len);
+     name[len] = '\0';
+ 
+     const Builtin *builtin = g_hash_table_lookup(builtins, name);
+     if (!builtin) return NULL;
+     const char *rest = line + len + strspn(line + len, " \t");
+     if ((builtin->flags & BUILTIN_NO_ARGS) && *rest) return NULL;
+     if (args) *args = rest;
+     return builtin;
+ }
+ 
+ /**
+  * @brief Süreç içi yerleşik komutu fork etmeden çalıştırır
+  * * Boru hattı veya yönlendirme içeren satırlar ("echo x > dosya") dış komut
+  * olarak çalıştırılmak üzere geri çevrilir.
+  * * @param tab_index Komutun çalıştırıldığı sekme
+  * @param builtin run alanı dolu yerleşik komut
+  * @param line Komut satırı
+  * @return int Komut burada çalıştırıldıysa 1
+  */
+ static int builtin_run_inline(int tab_index, const Builtin *builtin, const char *line) {
+     TokenList tokens;
+     const char *error;
+     if (tokenize(line, tab_index, &tokens, &error) == -1) return 0; // Hatayı run_pipeline bildirir
+     int status = -1;
+     int simple = 1;
+     for (int i = 0; i < tokens.argc; i++) {
+         if (tokens.flags[i] & TOKEN_OP) simple = 0;
+     }
+     if (simple) status = builtin->run(tab_index, tokens.argc, tokens.argv);
+     token_list_free(&tokens);
+     if (status == -1) return 0;
+     if (tab_index >= 0 && tab_index < MAX_TABS) tab_last_status[tab_index] = status;
+     return 1;
+ }
+ 
+ /**
+  * @brief Tek bir komutu (yerleşik komutlar dahil) hemen çalıştırır
+  * * Ön plandaki işler sekmeyi bitene kadar meşgul eder; '&' ile biten komutlar
+  * arka planda çalışır ve sekme hemen yeni komut kabul eder. Yerleşik komutlar
+  * başarılıysa çıkış kodu 0 olur; hata yolları command_error ile 1 yapar.
+  * * @param tab_index Komutun çalıştırılacağı sekme
+  * @param line Çalıştırılacak komut (değiştirilebilir, boşlukları atılmış)
+  */
+ static void execute_command(int tab_index, char *line) {
+     if (strpbrk(line, "$`") && subst_start(tab_index, line)) return; // Önce $(...) çıktısı beklenir
+     int background = strip_background(line);
+     const char *args = NULL;
+     const Builtin *builtin = builtin_lookup(line, &args);
+ 
+     if (*line == '\0') {
+         // Boş komutu çalıştırma ("&" tek başına sözdizimi hatasıdır)
+         if (background && output_callback) output_callback(tab_index, "Sözdizimi hatası: '&' yakınında\n", "red");
+     } else if (!builtin && run_assignments(tab_index, line)) {
+         // "AD=değer ..." yalnızca sekmenin değişkenlerini değiştirir
+     } else if (builtin && builtin->func) {
+         if (tab_index >= 0 && tab_index < MAX_TABS) tab_last_status[tab_index] = 0;
+         builtin->func(tab_index, args, background);
+     } else if (!builtin || !builtin_run_inline(tab_index, builtin, line)) {
+         start_job(tab_index, line, 0, background, NULL);
+     }
+ }
+ 
+ /**
+  * @brief ";", "&&" ve "||" ile bağlı komut listesini çalıştırır
+  * * "&&"den sonraki komut yalnızca önceki komutun çıkış kodu 0 ise, "||"den
+  * sonraki yalnızca 0 değilse çalışır; atlanan komutlar çıkış kodunu
+  * değiştirmez. Ön planda iş başlatan bir komuttan sonra liste durur: kalanı
+  * tab_sequence'e konur ve iş toplandığında tab_run_pending aynı yerden,
+  * işin çıkış koduyla sürdürür. Böylece "make && ./terminal_app" yoklama
+  * yapılmadan, bir işin bitiş olayından sonrakinin başlatılmasıyla ilerler.
+  * * @param tab_index Komutların çalıştırılacağı sekme
+  * @param list Komut listesi
+  * @param op İlk komuttan önceki bağlaç (satırın başı için LIST_SEQ)
+  */
+ static void run_list(int tab_index, const char *list, int op) {
+     const char *p = list;
+     for (;;) {
+         const char *end, *next;
+         int following = list_next(p, &end, &next);
+         int status = tab_index >= 0 && tab_index < MAX_TABS ? tab_last_status[tab_index] : 0;
+         if (op == LIST_SEQ || (op == LIST_AND) == (status == 0)) {
+             char *line = g_strndup(p, end - p);
+             g_strstrip(line);
+             execute_command(tab_index, line);
+             g_free(line);
+         }
+         if (following == LIST_END) return;
+         p = next;
+         op = following;
+         if (tab_is_busy(tab_index) && tab_index >= 0 && tab_index < MAX_TABS) {
+             g_free(tab_sequence[tab_index]);
+             tab_sequence[tab_index] = g_strdup(p);
+             tab_sequence_op[tab_index] = op;
+             return;
+         }
+     }
+ }
+ 
+ /**
+  * @brief Komut satırını sözdizimini denetleyip komut listesi olarak çalıştırır
+  * * Bağlaçlardan önce komut yoksa ("&& b", "a ;; b") veya satır "&&"/"||" ile
+  * bitiyorsa hiçbir komut çalıştırılmaz.
+  * * @param tab_index Komutun çalıştırılacağı sekme
+  * @param cmdline Çalıştırılacak satır
+  */
+ static void execute_line(int tab_index, const char *cmdline) {
+     static const char *const names[] = { "", ";", "&&", "||" };
+     const char *p = cmdline, *end, *next;
+     int op;
+     do {
+         op = list_next(p, &end, &next);
+         const char *q = p;
+         while (q < end && isspace((unsigned char)*q)) q++;
+         int lone_bg = q + 1 == end && *q == '&'; // Tek başına "&" de boş komuttur
+         if (op != LIST_END && (q == end || lone_bg)) {
+             char msg[64];
+             snprintf(msg, sizeof(msg), "Sözdizimi hatası: '%s' yakınında\n", lone_bg ? "&" : names[op]);
+             if (output_callback) output_callback(tab_index, msg, "red");
+             if (tab_index >= 0 && tab_index < MAX_TABS) tab_last_status[tab_index] = 2;
+             return;
+         }
+         if (op == LIST_AND || op == LIST_OR) {
+             const char *rest = next + strspn(next, " \t\r\n");
+             if (*rest == '\0') {
+                 char msg[64];
+                 snprintf(msg, sizeof(msg), "Sözdizimi hatası: satır '%s' ile bitiyor\n", names[op]);
+                 if (output_callback) output_callback(tab_index, msg, "red");
+                 if (tab_index >= 0 && tab_index < MAX_TABS) tab_last_status[tab_index] = 2;
+                 return;
+             }
+         }
+         p = next;
+     } while (op != LIST_END);
+     run_list(tab_index, cmdline, LIST_SEQ);
+ }
+ 
+ /**
+  * @brief Komut çalıştırma fonksiyonu (launcher kullanan versiyon)
+  * * Shell komutlarını ('|' ile bağlanmış boru hatları dahil) çalıştırır; çıktıları
+  * GTK ana döngüsü üzerinden geldikçe sekmeye aktarılır ve fonksiyon süreci
+  * beklemeden hemen döner. Sekmenin ön plandaki işi sürerken girilen komutlar
+  * sıraya alınır ve iş bitince çalıştırılır; yalnızca BUILTIN_IMMEDIATE ile
+  * kaydedilmiş yerleşikler (ps, jobs, bg, kill, spawnstat ve Controller'ın
+  * komutları) hemen çalışır ki meşgul sekmedeki işler yönetilebilsin.
+  * Yerleşik komutlar builtin_lookup ile tek bir tablodan bulunur. Satır ";",
+  * "&&" ve "||" ile bağlı bir komut listesi olabilir (bkz. run_list).
+  * * @param tab_index Komutun çalıştırılacağı sekme
+  * @param cmdline Çalıştırılacak komut
+  */
+ void model_execute_command(int tab_index, const char *cmdline) {
+     model_add_to_history(cmdline);  // Geçmişe ekle
+ 
+     if (tab_is_busy(tab_index)) {
+         const char *end, *next;
+         const Builtin *builtin = builtin_lookup(cmdline + strspn(cmdline, " "), NULL);
+         // "jobs; ls" gibi listeler ve $(...) ön plandaki işin ardından sırayla çalışmalı
+         if (!builtin || !(builtin->flags & BUILTIN_IMMEDIATE) || list_next(cmdline, &end, &next) != LIST_END ||
+             strstr(cmdline, "$(") || strchr(cmdline, '`')) {
+             char *copy = strdup(cmdline);
+             if (copy) g_queue_push_tail(&tab_pending[tab_index], copy);
+             return;
+         }
+     }
+     execute_line(tab_index, cmdline);
+ }
@@ -1,9 +1,20 @@
 #ifndef MODEL_H
 #define MODEL_H
 
+#define MAX_TABS 100 // Maksimum sekme sayısı (Model, View ve Controller ortak kullanır)
+
+// Yerleşik komut: satırın komut adından sonraki kısmını (baştaki boşluklar atılmış) alır
+typedef void (*BuiltinFunc)(int tab_index, const char *args, int background);
+#define BUILTIN_IMMEDIATE 1 // Sekme meşgulken de sıraya alınmadan çalışır
+#define BUILTIN_NO_ARGS   2 // Yalnızca argümansız biçim yerleşiktir ("ps aux" dış komuttur)
+
 void model_init(); // Eksik bildirim ekle
 void model_init_shared_memory();
 void model_execute_command(int tab_index, const char *cmdline);
+int model_tab_busy(int tab_index); // Komutun bitmesini beklemek için
+int model_get_last_status(int tab_index);
+int model_signal_foreground(int tab_index, int sig); // Ctrl+C / Ctrl+Z için
+void model_tab_closed(int tab_index); // Sekme kapanınca işlerini ve durumunu bırakır
 void model_send_message(int tab_index, const char *msg);
 void model_read_message(int tab_index);
 void model_cleanup();
@@ -12,6 +23,9 @@ void model_clear_message();
 const char* model_get_history(int index);
 int model_get_history_count();
 void model_add_to_history(const char *cmdline); // Eksik bildirim ekle
+const char* model_get_cwd(int tab_index); // Sekme başlığı için
+void model_register_builtin(const char *name, BuiltinFunc func, int flags); // Controller komutları için
+void model_set_cwd_callback(void (*callback)(int tab_index, const char *path));
 void model_set_output_callback(void (*callback)(int tab_index, const char *text, const char *color)); // Eksik bildirim ekle
 
 #endif
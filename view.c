@@ -7,12 +7,21 @@
  */
 
 #include <gtk/gtk.h>
+#include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 #include <time.h>
+#include <signal.h>
 #include "model.h"
+#include "view.h"
+#include "linestore.h"
+#include "ansi.h"
 
-#define MAX_TABS 100  // Maksimum sekme sayısı
+#define SCROLLBACK_DEFAULT_LINES 10000             // Yeni sekmelerin satır sınırı
+#define SCROLLBACK_DEFAULT_BYTES (16 * 1024 * 1024) // Yeni sekmelerin bayt sınırı
+#define SCROLLBACK_LIST_LINES 10000000                 // Liste görünümlü sekmelerin satır sınırı
+#define SCROLLBACK_LIST_BYTES (1024ULL * 1024 * 1024)  // Liste görünümlü sekmelerin bayt sınırı
+#define PENDING_FLUSH_BYTES (4 * 1024 * 1024)          // Kare beklenmeden aktarılan bekleyen çıktı
 
 // GTK widget ve uygulama değişkenleri
 static GtkNotebook *notebook;                 // Sekme konteynerı
@@ -20,9 +29,42 @@ static GtkApplication *app;                   // GTK uygulaması
 static GtkWidget *tab_outputs[MAX_TABS];      // Terminal çıktı alanları
 static GtkWidget *tab_inputs[MAX_TABS];       // Terminal giriş alanları
 static GtkWidget *tab_scrolls[MAX_TABS];      // Kaydırma panelleri
+static GtkWidget *tab_labels[MAX_TABS];       // Sekme başlıkları (çalışma dizinini gösterir)
 static int tab_count = 0;                     // Açık sekme sayısı
 static int next_index = 0;                    // Bir sonraki sekme indeksi
 static int history_index[MAX_TABS] = {0};     // Her sekme için geçmiş indeksi
+static LineStore *tab_lines[MAX_TABS];        // Liste görünümlü sekmenin satırları (NULL = GtkTextView)
+static gboolean list_output = FALSE;          // Yeni sekmeler GtkListView ile açılsın
+static AnsiDecoder tab_ansi[MAX_TABS];        // Komut çıktısındaki renk kodlarının çözücüsü
+
+/**
+ * @brief Sekmeye henüz yazılmamış çıktı, geri kaydırma sınırı ve çizim istatistikleri
+ * 
+ * Eklenen metin önce burada birikir; her karede (frame clock tick) bir kez,
+ * stil başına tek insert ve tek kaydırma ile tampona aktarılır. Tampon
+ * sınırı aşınca baştan büyük parçalar halinde kırpılır. Pencere gizliyken
+ * kare gelmeyebilir; bekleyen metin PENDING_FLUSH_BYTES'ı geçince hemen aktarılır.
+ */
+typedef struct {
+    GString *text;      // Bekleyen metin
+    GArray *runs;       // StyleRun: aynı etiketli ardışık parçalar
+    guint tick_id;      // Bekleyen aktarım için tick callback (0 = yok)
+    guint64 frames;     // Aktarım yapılan kare sayısı
+    guint64 bytes;      // Aktarılan toplam bayt
+    gint64 usec;        // Aktarımlarda (insert + kaydırma) geçen toplam süre
+    int max_lines;      // Geri kaydırma satır sınırı (0 = sınırsız)
+    guint64 max_bytes;  // Geri kaydırma bayt sınırı (0 = sınırsız)
+    guint64 stored;     // Tampondaki metnin bayt sayısı
+    guint64 trims;      // Baştan kırpma sayısı
+} TabRender;
+
+typedef struct {
+    GtkTextTag *tag;    // Tamponun etiketi (style_tag ile tekil)
+    int style;          // Liste görünümünde LineStore stil kimliği
+    gsize end;          // Parçanın text içindeki bitiş konumu
+} StyleRun;
+
+static TabRender tab_render[MAX_TABS];
 
 // Callback fonksiyonları
 static void (*input_callback)(int tab_index, const char *input) = NULL;
@@ -57,9 +99,23 @@ void view_set_message_callback(void (*callback)(const char *msg)) {
 /**
  * @brief Terminal çıktı alanını en alta kaydıran fonksiyon
  * 
+ * gtk_list_view_scroll_to GTK 4.12 ile geldi; daha eski GTK 4'te liste
+ * görünümünün dikey ayarı en sona çekilir. Ayarın üst sınırı yeni satırlar
+ * yerleştirildikten sonra güncellendiğinden görünüm bir kare geriden gelir.
+ * 
  * @param tab_index Kaydırılacak sekmenin indeksi
  */
 static void scroll_to_bottom(int tab_index) {
+    if (tab_lines[tab_index]) {
+#if GTK_CHECK_VERSION(4, 12, 0)
+        guint n = g_list_model_get_n_items(G_LIST_MODEL(tab_lines[tab_index]));
+        if (n > 0) gtk_list_view_scroll_to(GTK_LIST_VIEW(tab_outputs[tab_index]), n - 1, GTK_LIST_SCROLL_NONE, NULL);
+#else
+        GtkAdjustment *adj = gtk_scrollable_get_vadjustment(GTK_SCROLLABLE(tab_outputs[tab_index]));
+        if (adj) gtk_adjustment_set_value(adj, gtk_adjustment_get_upper(adj) - gtk_adjustment_get_page_size(adj));
+#endif
+        return;
+    }
     GtkTextView *text_view = GTK_TEXT_VIEW(tab_outputs[tab_index]);
     GtkTextBuffer *buffer = gtk_text_view_get_buffer(text_view);
     GtkTextIter iter;
@@ -68,17 +124,226 @@ static void scroll_to_bottom(int tab_index) {
 }
 
 /**
- * @brief Terminal çıktısını renkli metin olarak ekleyen fonksiyon
+ * @brief Bir stil için tamponun etiketini döndürür, yoksa bir kez oluşturur
+ * 
+ * Etiketler tamponun etiket tablosunda stilden türetilen adla tutulur
+ * ("fg:red", "fg:red;b;u"); aynı stil her zaman aynı etiketi kullanır.
+ * Her çıktı parçası için yeni adsız etiket oluşturulsaydı tablo sınırsız
+ * büyür, bellek ve yerleşim maliyeti her eklemeyle artardı.
+ * 
+ * @param buffer Etiketin ait olacağı tampon
+ * @param color Ön plan rengi
+ * @param attrs VIEW_ATTR_* bayrakları
+ * @return GtkTextTag* Tamponun etiketi
+ */
+static GtkTextTag* style_tag(GtkTextBuffer *buffer, const char *color, int attrs) {
+    char name[96];
+    snprintf(name, sizeof(name), "fg:%s%s%s", color,
+             (attrs & VIEW_ATTR_BOLD) ? ";b" : "", (attrs & VIEW_ATTR_UNDERLINE) ? ";u" : "");
+
+    GtkTextTagTable *table = gtk_text_buffer_get_tag_table(buffer);
+    GtkTextTag *tag = gtk_text_tag_table_lookup(table, name);
+    if (tag) return tag;
+
+    tag = gtk_text_buffer_create_tag(buffer, name, "foreground", color, NULL);
+    if (attrs & VIEW_ATTR_BOLD) g_object_set(tag, "weight", PANGO_WEIGHT_BOLD, NULL);
+    if (attrs & VIEW_ATTR_UNDERLINE) g_object_set(tag, "underline", PANGO_UNDERLINE_SINGLE, NULL);
+    return tag;
+}
+
+/**
+ * @brief Tampon geri kaydırma sınırını aştıysa baştan kırpar
+ * 
+ * Sınır her satırda değil, payın (sınırın 1/8'i) da aşılmasıyla tetiklenir ve
+ * tampon sınıra inene kadar tek gtk_text_buffer_delete ile silinir; kırpma
+ * maliyeti silinen parçaya bölünür. Silinen aralıktaki etiket geçişleri de
+ * ağaçtan kalkar; etiketlerin kendisi stil başına tek olduğundan tabloda kalır.
+ * Liste görünümünde baştaki parçalar (chunk) bütün olarak atılır.
+ * 
+ * @param tab_index Sekme indeksi
+ * @param exact Pay beklemeden hemen sınıra indir (sınır değiştirildiğinde)
+ */
+static void trim_scrollback(int tab_index, gboolean exact) {
+    TabRender *render = &tab_render[tab_index];
+    if (tab_lines[tab_index]) {
+        if (line_store_trim(tab_lines[tab_index], render->max_lines, render->max_bytes)) render->trims++;
+        render->stored = line_store_get_bytes(tab_lines[tab_index]);
+        return;
+    }
+    GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(tab_outputs[tab_index]));
+    int lines = gtk_text_buffer_get_line_count(buffer);
+    int excess_lines = 0;
+    guint64 excess_bytes = 0;
+    if (render->max_lines > 0 && lines > render->max_lines + (exact ? 0 : MAX(render->max_lines / 8, 1))) {
+        excess_lines = lines - render->max_lines;
+    }
+    if (render->max_bytes > 0 && render->stored > render->max_bytes + (exact ? 0 : render->max_bytes / 8)) {
+        excess_bytes = render->stored - render->max_bytes;
+    }
+    if (excess_lines == 0 && excess_bytes == 0) return;
+
+    // Kesim noktası satır başına denk gelir; silinen bayt satır satır toplanır
+    GtkTextIter start, cut;
+    gtk_text_buffer_get_start_iter(buffer, &cut);
+    guint64 removed = 0;
+    for (int line = 0; line < excess_lines || removed < excess_bytes; line++) {
+        removed += gtk_text_iter_get_bytes_in_line(&cut);
+        if (!gtk_text_iter_forward_line(&cut)) break; // Son satır: tamamı silinir
+    }
+    gtk_text_buffer_get_start_iter(buffer, &start);
+    gtk_text_buffer_delete(buffer, &start, &cut);
+    render->stored = removed < render->stored ? render->stored - removed : 0;
+    render->trims++;
+}
+
+/**
+ * @brief Sekmede bekleyen çıktıyı tampona aktarır
+ * 
+ * Her stil parçası tek insert ile eklenir, ardından bir kez kaydırılır;
+ * yerleşim (layout) her okuma yerine karede bir kez hesaplanır.
+ * 
+ * @param tab_index Sekme indeksi
+ */
+static void flush_pending_output(int tab_index) {
+    TabRender *render = &tab_render[tab_index];
+    if (!render->text || render->text->len == 0 || !tab_outputs[tab_index]) return;
+
+    gint64 start = g_get_monotonic_time();
+    gsize offset = 0;
+    if (tab_lines[tab_index]) {
+        for (guint i = 0; i < render->runs->len; i++) {
+            StyleRun *run = &g_array_index(render->runs, StyleRun, i);
+            line_store_append(tab_lines[tab_index], render->text->str + offset, run->end - offset, run->style);
+            offset = run->end;
+        }
+        line_store_commit(tab_lines[tab_index]); // Karede tek items-changed
+    } else {
+        GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(tab_outputs[tab_index]));
+        GtkTextIter end;
+        gtk_text_buffer_get_end_iter(buffer, &end);
+        for (guint i = 0; i < render->runs->len; i++) {
+            StyleRun *run = &g_array_index(render->runs, StyleRun, i);
+            // insert iter'i eklenen metnin sonuna taşır
+            gtk_text_buffer_insert_with_tags(buffer, &end, render->text->str + offset, run->end - offset, run->tag, NULL);
+            offset = run->end;
+        }
+    }
+    render->stored += render->text->len;
+    trim_scrollback(tab_index, FALSE);
+    scroll_to_bottom(tab_index);
+
+    render->frames++;
+    render->bytes += render->text->len;
+    render->usec += g_get_monotonic_time() - start;
+    g_string_truncate(render->text, 0);
+    g_array_set_size(render->runs, 0);
+}
+
+/**
+ * @brief Kare saatinden çağrılır: bekleyen çıktıyı aktarır ve kendini kaldırır
+ */
+static gboolean on_output_tick(GtkWidget *widget, GdkFrameClock *clock, gpointer user_data) {
+    int tab_index = GPOINTER_TO_INT(user_data);
+    tab_render[tab_index].tick_id = 0;
+    flush_pending_output(tab_index);
+    return G_SOURCE_REMOVE;
+}
+
+/**
+ * @brief Sekmenin bekleyen çıktısını atar ve tick callback'ini kaldırır
  * 
- * @param buffer Metin ekleme hedefi (GtkTextBuffer)
+ * @param tab_index Sekme indeksi
+ * @param release Sekme kapanıyorsa TRUE: tamponlar da serbest bırakılır
+ */
+static void drop_pending_output(int tab_index, gboolean release) {
+    TabRender *render = &tab_render[tab_index];
+    if (render->tick_id && tab_outputs[tab_index]) {
+        gtk_widget_remove_tick_callback(tab_outputs[tab_index], render->tick_id);
+    }
+    render->tick_id = 0;
+    if (!render->text) return;
+    if (release) {
+        g_string_free(render->text, TRUE);
+        g_array_free(render->runs, TRUE);
+        memset(render, 0, sizeof(*render));
+    } else {
+        g_string_truncate(render->text, 0);
+        g_array_set_size(render->runs, 0);
+    }
+}
+
+/**
+ * @brief Metni sekmenin bekleyen çıktısına ekler
+ * 
+ * Metin hemen tampona yazılmaz; bir sonraki karede topluca aktarılır. Önceki
+ * parçayla aynı stildeki metin aynı parçaya katılır.
+ * 
+ * @param tab_index Hedef sekme indeksi (geçerli olmalı)
+ * @param text Eklenecek metin (NUL ile bitmesi gerekmez)
+ * @param len Metnin bayt uzunluğu
+ * @param color Metnin rengi (NULL = beyaz)
+ * @param attrs VIEW_ATTR_* bayrakları
+ */
+static void queue_output(int tab_index, const char *text, gsize len, const char *color, int attrs) {
+    if (!color) color = "white";
+    GtkTextTag *tag = NULL;
+    int style = -1;
+    if (tab_lines[tab_index]) {
+        style = line_store_style(tab_lines[tab_index], color, attrs);
+    } else {
+        GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(tab_outputs[tab_index]));
+        tag = style_tag(buffer, color, attrs);
+    }
+
+    TabRender *render = &tab_render[tab_index];
+    if (!render->text) {
+        render->text = g_string_sized_new(4096);
+        render->runs = g_array_new(FALSE, FALSE, sizeof(StyleRun));
+    }
+    g_string_append_len(render->text, text, len);
+    StyleRun *last = render->runs->len ? &g_array_index(render->runs, StyleRun, render->runs->len - 1) : NULL;
+    if (last && last->tag == tag && last->style == style) {
+        last->end = render->text->len;
+    } else {
+        StyleRun run = { tag, style, render->text->len };
+        g_array_append_val(render->runs, run);
+    }
+
+    // Kare saati durmuşsa (simge durumundaki veya gizli pencere) bekleyen metin
+    // sınırsız büyümesin; aktarılan metin geri kaydırma sınırıyla kırpılır
+    if (render->text->len >= PENDING_FLUSH_BYTES) {
+        flush_pending_output(tab_index);
+        return;
+    }
+    if (!render->tick_id) {
+        render->tick_id = gtk_widget_add_tick_callback(tab_outputs[tab_index], on_output_tick,
+                                                       GINT_TO_POINTER(tab_index), NULL);
+    }
+}
+
+/**
+ * @brief Belirtilen sekmeye renkli ve biçimli (kalın, altı çizili) metin ekleyen fonksiyon
+ * 
+ * @param tab_index Hedef sekme indeksi
  * @param text Eklenecek metin
  * @param color Metnin rengi
+ * @param attrs VIEW_ATTR_* bayrakları (0 = düz)
  */
-static void insert_colored_text(GtkTextBuffer *buffer, const char *text, const char *color) {
-    GtkTextIter end;
-    gtk_text_buffer_get_end_iter(buffer, &end);
-    GtkTextTag *tag = gtk_text_buffer_create_tag(buffer, NULL, "foreground", color, NULL);
-    gtk_text_buffer_insert_with_tags(buffer, &end, text, -1, tag, NULL);
+void view_append_output_styled(int tab_index, const char *text, const char *color, int attrs) {
+    if (tab_index < 0 || tab_index >= MAX_TABS || !tab_outputs[tab_index] || !text || !*text) return;
+    queue_output(tab_index, text, strlen(text), color, attrs);
+}
+
+/**
+ * @brief ANSI çözücüsünün verdiği düz metin parçasını sekmeye ekler
+ * 
+ * Renkler "#rrggbb" adlı etiketlere dönüşür; etiketler stil başına bir kez
+ * oluşturulur (bkz. style_tag).
+ */
+static void on_ansi_text(void *ctx, const char *text, size_t len, const char *color, int attrs) {
+    int view_attrs = ((attrs & ANSI_ATTR_BOLD) ? VIEW_ATTR_BOLD : 0) |
+                     ((attrs & ANSI_ATTR_UNDERLINE) ? VIEW_ATTR_UNDERLINE : 0);
+    queue_output(GPOINTER_TO_INT(ctx), text, len, color, view_attrs);
 }
 
 /**
@@ -89,10 +354,80 @@ static void insert_colored_text(GtkTextBuffer *buffer, const char *text, const c
  * @param color Metnin rengi
  */
 void view_append_output_colored(int tab_index, const char *text, const char *color) {
-    if (tab_index < 0 || tab_index >= MAX_TABS || !tab_outputs[tab_index] || !text) return;
+    view_append_output_styled(tab_index, text, color, 0);
+}
+
+/**
+ * @brief Sekmenin tamponundaki etiket sayısını döndürür ("meminfo" için)
+ * 
+ * Liste görünümünde depodaki stil sayısı döner.
+ * 
+ * @param tab_index Sekme indeksi
+ * @return int Etiket sayısı, sekme yoksa -1
+ */
+int view_get_tag_count(int tab_index) {
+    if (tab_index < 0 || tab_index >= MAX_TABS || !tab_outputs[tab_index]) return -1;
+    if (tab_lines[tab_index]) return (int)line_store_get_n_styles(tab_lines[tab_index]);
     GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(tab_outputs[tab_index]));
-    insert_colored_text(buffer, text, color);
-    scroll_to_bottom(tab_index);
+    return gtk_text_tag_table_get_size(gtk_text_buffer_get_tag_table(buffer));
+}
+
+/**
+ * @brief Sekmenin geri kaydırma sınırını değiştirir
+ * 
+ * Tampon yeni sınırı aşıyorsa hemen kırpılır.
+ * 
+ * @param tab_index Sekme indeksi
+ * @param lines Satır sınırı (0 = sınırsız, -1 = değiştirme)
+ * @param bytes Bayt sınırı (0 = sınırsız, G_MAXUINT64 = değiştirme)
+ */
+void view_set_scrollback(int tab_index, int lines, guint64 bytes) {
+    if (tab_index < 0 || tab_index >= MAX_TABS || !tab_outputs[tab_index]) return;
+    if (lines >= 0) tab_render[tab_index].max_lines = lines;
+    if (bytes != G_MAXUINT64) tab_render[tab_index].max_bytes = bytes;
+    trim_scrollback(tab_index, TRUE);
+}
+
+/**
+ * @brief Sekmenin geri kaydırma sınırını ve tamponun doluluğunu döndürür
+ * 
+ * @param tab_index Sekme indeksi
+ * @param max_lines Satır sınırı (0 = sınırsız)
+ * @param max_bytes Bayt sınırı (0 = sınırsız)
+ * @param lines Tampondaki satır sayısı
+ * @param bytes Tampondaki bayt sayısı
+ * @param trims Baştan kırpma sayısı
+ * @return int Sekme yoksa 0
+ */
+int view_get_scrollback(int tab_index, int *max_lines, guint64 *max_bytes, int *lines, guint64 *bytes, guint64 *trims) {
+    if (tab_index < 0 || tab_index >= MAX_TABS || !tab_outputs[tab_index]) return 0;
+    *max_lines = tab_render[tab_index].max_lines;
+    *max_bytes = tab_render[tab_index].max_bytes;
+    if (tab_lines[tab_index]) {
+        *lines = (int)line_store_get_n_lines(tab_lines[tab_index]);
+    } else {
+        *lines = gtk_text_buffer_get_line_count(gtk_text_view_get_buffer(GTK_TEXT_VIEW(tab_outputs[tab_index])));
+    }
+    *bytes = tab_render[tab_index].stored;
+    *trims = tab_render[tab_index].trims;
+    return 1;
+}
+
+/**
+ * @brief Sekmenin çizim istatistiklerini döndürür ("meminfo" için)
+ * 
+ * @param tab_index Sekme indeksi
+ * @param frames Çıktı aktarılan kare sayısı
+ * @param bytes Aktarılan toplam bayt
+ * @param usec Aktarımlarda geçen toplam süre (mikrosaniye)
+ * @return int Sekme yoksa 0
+ */
+int view_get_render_stats(int tab_index, guint64 *frames, guint64 *bytes, gint64 *usec) {
+    if (tab_index < 0 || tab_index >= MAX_TABS || !tab_outputs[tab_index]) return 0;
+    *frames = tab_render[tab_index].frames;
+    *bytes = tab_render[tab_index].bytes;
+    *usec = tab_render[tab_index].usec;
+    return 1;
 }
 
 /**
@@ -102,6 +437,12 @@ void view_append_output_colored(int tab_index, const char *text, const char *col
  */
 void view_clear_terminal(int tab_index) {
     if (tab_index < 0 || tab_index >= MAX_TABS || !tab_outputs[tab_index]) return;
+    drop_pending_output(tab_index, FALSE); // clear'dan önce gelmiş ama henüz yazılmamış çıktı da silinir
+    tab_render[tab_index].stored = 0;
+    if (tab_lines[tab_index]) {
+        line_store_clear(tab_lines[tab_index]);
+        return;
+    }
     GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(tab_outputs[tab_index]));
     gtk_text_buffer_set_text(buffer, "", -1);
     scroll_to_bottom(tab_index);
@@ -110,31 +451,37 @@ void view_clear_terminal(int tab_index) {
 /**
  * @brief Giriş alanında klavye olaylarını işleyen fonksiyon
  * 
- * Yukarı/aşağı ok tuşları ile komut geçmişine erişimi sağlar
+ * Yukarı/aşağı ok tuşları ile komut geçmişine erişimi sağlar.
+ * Ctrl+C ön plandaki işi keser, Ctrl+Z durdurur. Denetleyici yakalama
+ * (capture) aşamasında çalışır; aksi halde GtkText Ctrl+C'yi kopyalama,
+ * Ctrl+Z'yi geri alma olarak önce işler. Sinyallenecek iş yoksa tuş GtkText'e
+ * bırakılır, yani kopyalama çalışmaya devam eder.
  * 
  * @param controller Klavye olay denetleyicisi
  * @param keyval Basılan tuşun değeri
  * @param keycode Tuş kodu
  * @param state Tuş durumu (Shift, Ctrl, vb.)
  * @param user_data Kullanıcı verisi (sekme indeksi)
+ * @return gboolean Tuş işlendiyse TRUE
  */
-static void on_entry_key_press(GtkEventControllerKey *controller, guint keyval, guint keycode, GdkModifierType state, gpointer user_data) {
+static gboolean on_entry_key_press(GtkEventControllerKey *controller, guint keyval, guint keycode, GdkModifierType state, gpointer user_data) {
     int tab_index = GPOINTER_TO_INT(user_data);
     GtkWidget *entry = tab_inputs[tab_index];
     int count = model_get_history_count();
 
     if (keyval == GDK_KEY_Up) {
         // Yukarı tuşu - önceki komut
-        if (count == 0) return;
+        if (count == 0) return FALSE;
         if (history_index[tab_index] > 0)
             history_index[tab_index]--;
         const char *cmd = model_get_history(history_index[tab_index]);
         if (cmd)
             gtk_editable_set_text(GTK_EDITABLE(entry), cmd);
         gtk_widget_grab_focus(entry);
+        return TRUE;
     } else if (keyval == GDK_KEY_Down) {
         // Aşağı tuşu - sonraki komut
-        if (count == 0) return;
+        if (count == 0) return FALSE;
         if (history_index[tab_index] < count - 1)
             history_index[tab_index]++;
         const char *cmd = model_get_history(history_index[tab_index]);
@@ -143,7 +490,12 @@ static void on_entry_key_press(GtkEventControllerKey *controller, guint keyval,
         else
             gtk_editable_set_text(GTK_EDITABLE(entry), "");
         gtk_widget_grab_focus(entry);
+        return TRUE;
+    } else if ((state & GDK_CONTROL_MASK) && (keyval == GDK_KEY_c || keyval == GDK_KEY_z)) {
+        // Ctrl+C / Ctrl+Z - ön plandaki işe SIGINT / SIGTSTP gönder
+        return model_signal_foreground(tab_index, keyval == GDK_KEY_c ? SIGINT : SIGTSTP) == 1;
     }
+    return FALSE;
 }
 
 /**
@@ -185,15 +537,26 @@ void view_set_input_callback(void (*callback)(int tab_index, const char *input))
 /**
  * @brief Sekme kapatma olayını işleyen fonksiyon
  * 
+ * Sekme dizileri sekme indeksine göre tutulur; bu, önceki sekmeler kapanınca
+ * veya sekmeler sürüklenince defterdeki sayfa numarasından farklılaşır. İndeks
+ * bu yüzden içerik widget'ından okunur, sayfa numarası yalnızca sayfayı
+ * kaldırmak için kullanılır.
+ * 
  * @param child Kapatılacak sekmenin içerik widget'ı
  */
 static void close_tab(GtkWidget *child) {
     int page = gtk_notebook_page_num(notebook, child);
     if (page != -1) {
+        int index = GPOINTER_TO_INT(g_object_get_data(G_OBJECT(child), "tab-index"));
+        model_tab_closed(index); // Sekmenin işleri SIGHUP alır, dizini ve değişkenleri bırakılır
+        drop_pending_output(index, TRUE);
         gtk_notebook_remove_page(notebook, page);
-        tab_outputs[page] = NULL;
-        tab_inputs[page] = NULL;
-        tab_scrolls[page] = NULL;
+        tab_outputs[index] = NULL;
+        tab_lines[index] = NULL; // Depo liste görünümüyle birlikte yok edildi
+        ansi_decoder_init(&tab_ansi[index]);
+        tab_inputs[index] = NULL;
+        tab_scrolls[index] = NULL;
+        tab_labels[index] = NULL;
 
         // Eğer hiç sekme kalmadıysa hoş geldiniz ekranını göster
         if (gtk_notebook_get_n_pages(notebook) == 0) {
@@ -210,6 +573,55 @@ static void close_tab(GtkWidget *child) {
     }
 }
 
+/**
+ * @brief Liste görünümünde satır widget'ını oluşturur (yalnızca görünen satır sayısı kadar)
+ */
+static void on_line_setup(GtkSignalListItemFactory *factory, GtkListItem *item, gpointer user_data) {
+    GtkWidget *label = gtk_label_new(NULL);
+    gtk_label_set_xalign(GTK_LABEL(label), 0.0);
+    gtk_label_set_selectable(GTK_LABEL(label), TRUE);
+    gtk_widget_add_css_class(label, "terminal-line");
+    gtk_list_item_set_child(item, label);
+}
+
+/**
+ * @brief Satır widget'ını görünüme giren satıra bağlar: metin ve renkler
+ * 
+ * @param user_data Sekmenin LineStore'u
+ */
+static void on_line_bind(GtkSignalListItemFactory *factory, GtkListItem *item, gpointer user_data) {
+    GtkLabel *label = GTK_LABEL(gtk_list_item_get_child(item));
+    GtkStringObject *line = gtk_list_item_get_item(item);
+    PangoAttrList *attrs = line_store_get_attrs(user_data, gtk_list_item_get_position(item));
+    gtk_label_set_text(label, gtk_string_object_get_string(line));
+    gtk_label_set_attributes(label, attrs);
+    pango_attr_list_unref(attrs);
+}
+
+/**
+ * @brief Sanal (virtualized) çıktı alanı: LineStore üzerinde GtkListView
+ * 
+ * Yalnızca ekranda görünen satırlar ölçülür ve çizilir; milyonlarca satırlık
+ * çıktıda da açılış, kaydırma ve yeniden boyutlandırma hızlı kalır.
+ * view_append_output* çağrıları aynen çalışır; satırlar tek tek seçilebilir.
+ * 
+ * @param index Sekme indeksi
+ * @return GtkWidget* Liste görünümü
+ */
+static GtkWidget* create_line_view(int index) {
+    LineStore *store = line_store_new();
+    GtkListItemFactory *factory = gtk_signal_list_item_factory_new();
+    g_signal_connect(factory, "setup", G_CALLBACK(on_line_setup), NULL);
+    g_signal_connect(factory, "bind", G_CALLBACK(on_line_bind), store);
+
+    // Seçim modeli deponun, liste görünümü modelin ve fabrikanın sahibi olur
+    GtkNoSelection *selection = gtk_no_selection_new(G_LIST_MODEL(store));
+    GtkWidget *list = gtk_list_view_new(GTK_SELECTION_MODEL(selection), factory);
+    gtk_widget_add_css_class(list, "terminal-output");
+    tab_lines[index] = store;
+    return list;
+}
+
 /**
  * @brief Yeni terminal sekmesi içeriğini oluşturan fonksiyon
  * 
@@ -221,9 +633,20 @@ static GtkWidget* create_terminal_tab(int index) {
     GtkWidget *box = gtk_box_new(GTK_ORIENTATION_VERTICAL, 0);
 
     // Terminal çıktı alanı
-    GtkWidget *text_view = gtk_text_view_new();
-    gtk_text_view_set_editable(GTK_TEXT_VIEW(text_view), FALSE);
-    gtk_text_view_set_cursor_visible(GTK_TEXT_VIEW(text_view), FALSE);
+    GtkWidget *text_view;
+    if (list_output) {
+        text_view = create_line_view(index);
+        tab_render[index].max_lines = SCROLLBACK_LIST_LINES;
+        tab_render[index].max_bytes = SCROLLBACK_LIST_BYTES;
+    } else {
+        text_view = gtk_text_view_new();
+        gtk_text_view_set_editable(GTK_TEXT_VIEW(text_view), FALSE);
+        gtk_text_view_set_cursor_visible(GTK_TEXT_VIEW(text_view), FALSE);
+        // Çıktı geri alınmaz; açık kalırsa kırpılan metin geri alma geçmişinde yaşar
+        gtk_text_buffer_set_enable_undo(gtk_text_view_get_buffer(GTK_TEXT_VIEW(text_view)), FALSE);
+        tab_render[index].max_lines = SCROLLBACK_DEFAULT_LINES;
+        tab_render[index].max_bytes = SCROLLBACK_DEFAULT_BYTES;
+    }
     
     // Kaydırma paneli
     GtkWidget *scroll = gtk_scrolled_window_new();
@@ -242,6 +665,7 @@ static GtkWidget* create_terminal_tab(int index) {
 
     // Klavye olay işleyicisi ekle
     GtkEventController *key_ctrl = gtk_event_controller_key_new();
+    gtk_event_controller_set_propagation_phase(key_ctrl, GTK_PHASE_CAPTURE); // GtkText'ten önce
     g_signal_connect(key_ctrl, "key-pressed", G_CALLBACK(on_entry_key_press), GINT_TO_POINTER(index));
     gtk_widget_add_controller(entry, key_ctrl);
 
@@ -271,6 +695,7 @@ static GtkWidget* create_terminal_tab(int index) {
     gtk_box_append(GTK_BOX(box), input_row);
     
     tab_outputs[index] = text_view;
+    ansi_decoder_init(&tab_ansi[index]);
     tab_inputs[index] = entry;
     tab_scrolls[index] = scroll;
     history_index[index] = model_get_history_count();
@@ -278,6 +703,31 @@ static GtkWidget* create_terminal_tab(int index) {
     return box;
 }
 
+/**
+ * @brief Sekme başlığını çalışma dizinine göre günceller
+ * 
+ * Başlıkta dizinin son bileşeni (ev dizini için "~"), ipucunda tam yol gösterilir.
+ * 
+ * @param tab_index Sekme indeksi
+ * @param path Sekmenin çalışma dizini (NULL ise yalnızca sekme numarası)
+ */
+void view_set_tab_title(int tab_index, const char *path) {
+    if (tab_index < 0 || tab_index >= MAX_TABS || !tab_labels[tab_index]) return;
+    gchar *text;
+    if (!path) {
+        text = g_strdup_printf("Terminal %d", tab_index + 1);
+    } else if (strcmp(path, g_get_home_dir()) == 0) {
+        text = g_strdup_printf("Terminal %d: ~", tab_index + 1);
+    } else {
+        gchar *base = g_path_get_basename(path);
+        text = g_strdup_printf("Terminal %d: %s", tab_index + 1, base);
+        g_free(base);
+    }
+    gtk_label_set_text(GTK_LABEL(tab_labels[tab_index]), text);
+    gtk_widget_set_tooltip_text(tab_labels[tab_index], path);
+    g_free(text);
+}
+
 /**
  * @brief Yeni bir terminal sekmesi oluşturan fonksiyon
  */
@@ -290,11 +740,12 @@ void view_create_tab() {
     if (index >= MAX_TABS) return;
 
     GtkWidget *tab_content = create_terminal_tab(index);
+    g_object_set_data(G_OBJECT(tab_content), "tab-index", GINT_TO_POINTER(index)); // close_tab için
 
-    gchar *label_text = g_strdup_printf("Terminal %d", index + 1);
     GtkWidget *label_box = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 2);
-    GtkWidget *label = gtk_label_new(label_text);
-    g_free(label_text);
+    GtkWidget *label = gtk_label_new(NULL);
+    tab_labels[index] = label;
+    view_set_tab_title(index, model_get_cwd(index));
 
     GtkWidget *close_button = gtk_button_new_with_label("X");
     gtk_widget_set_size_request(close_button, 20, 20);
@@ -306,9 +757,9 @@ void view_create_tab() {
     gtk_box_append(GTK_BOX(label_box), label);
     gtk_box_append(GTK_BOX(label_box), close_button);
 
-    gtk_notebook_append_page(notebook, tab_content, label_box);
+    int page = gtk_notebook_append_page(notebook, tab_content, label_box);
     gtk_notebook_set_tab_reorderable(notebook, tab_content, TRUE);
-    gtk_notebook_set_current_page(notebook, index);
+    gtk_notebook_set_current_page(notebook, page);
 
     tab_count++;
 }
@@ -316,6 +767,9 @@ void view_create_tab() {
 /**
  * @brief Terminal çıktısını ekleyen fonksiyon
  * 
+ * Renk belirtilmemiş çıktı (komutların stdout/stderr'i) sekmenin ANSI
+ * çözücüsünden geçer; dizi okumalar arasında bölünse de renk korunur.
+ * 
  * @param tab_index Hedef sekme indeksi
  * @param text Eklenecek metin
  */
@@ -324,8 +778,9 @@ void view_append_output(int tab_index, const char *text) {
         view_append_output_colored(tab_index, text, "deepskyblue");
     } else if (strstr(text, "[Çıktı limiti") != NULL) {
         view_append_output_colored(tab_index, text, "red");
-    } else {
-        view_append_output_colored(tab_index, text, "white");
+    } else if (tab_index >= 0 && tab_index < MAX_TABS && tab_outputs[tab_index]) {
+        // Komut çıktısı: "\033[...m" renk kodları çözülür, diğer diziler atılır
+        ansi_decode(&tab_ansi[tab_index], text, strlen(text), on_ansi_text, GINT_TO_POINTER(tab_index));
     }
 }
 
@@ -341,6 +796,32 @@ GtkWidget* view_get_output_widget(int tab_index) {
     return NULL;
 }
 
+/**
+ * @brief Yeni açılacak sekmelerin çıktı alanını seçer
+ * 
+ * @param list TRUE: sanal liste görünümü (GtkListView), FALSE: GtkTextView
+ */
+void view_set_list_output(gboolean list) {
+    list_output = list;
+}
+
+/**
+ * @brief Yeni sekmelerin liste görünümüyle açılıp açılmayacağını döndürür
+ */
+gboolean view_get_list_output(void) {
+    return list_output;
+}
+
+/**
+ * @brief Sekme liste görünümlü mü
+ * 
+ * @param tab_index Sekme indeksi
+ * @return gboolean Liste görünümüyse TRUE
+ */
+gboolean view_tab_is_list(int tab_index) {
+    return tab_index >= 0 && tab_index < MAX_TABS && tab_lines[tab_index] != NULL;
+}
+
 /**
  * @brief Mesajları kontrol eden ve işleyen fonksiyon
  * 
@@ -358,7 +839,7 @@ static gboolean poll_messages(gpointer user_data) {
         
         // Tüm aktif sekmelere mesajı gönder
         for (int i = 0; i < MAX_TABS; i++) {
-            if (tab_outputs[i] && GTK_IS_TEXT_VIEW(tab_outputs[i])) {
+            if (tab_outputs[i]) {
                 view_append_output_colored(i, msg, "deepskyblue");
                 view_append_output(i, "\n");
             }
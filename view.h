@@ -2,14 +2,27 @@
 #define VIEW_H
 
 #include <gtk/gtk.h>  // GTK header dosyasını ekle
+#include "model.h"    // MAX_TABS için
+
+#define VIEW_ATTR_BOLD      1 // Kalın
+#define VIEW_ATTR_UNDERLINE 2 // Altı çizili
 
 void view_init(int argc, char **argv);
 void view_main_loop();
 void view_create_tab();
 void view_append_output(int tab_index, const char *text);
 void view_append_output_colored(int tab_index, const char *text, const char *color);
+void view_append_output_styled(int tab_index, const char *text, const char *color, int attrs);
 void view_clear_terminal(int tab_index);
+void view_set_tab_title(int tab_index, const char *path);
 void view_set_input_callback(void (*callback)(int tab_index, const char *input));
 GtkWidget* view_get_output_widget(int tab_index);
+int view_get_tag_count(int tab_index);
+int view_get_render_stats(int tab_index, guint64 *frames, guint64 *bytes, gint64 *usec);
+void view_set_scrollback(int tab_index, int lines, guint64 bytes);
+void view_set_list_output(gboolean list);
+gboolean view_get_list_output(void);
+gboolean view_tab_is_list(int tab_index);
+int view_get_scrollback(int tab_index, int *max_lines, guint64 *max_bytes, int *lines, guint64 *bytes, guint64 *trims);
 
 #endif